@@ -914,9 +914,40 @@ enum {
   MPC_TYPE_CHECK_WITH = 26,
 
   MPC_TYPE_SOI        = 27,
-  MPC_TYPE_EOI        = 28
+  MPC_TYPE_EOI        = 28,
+
+  MPC_TYPE_DFA        = 29
 };
 
+/*
+** Regexes made of characters and character classes, each possibly
+** repeated, are also compiled to a DFA. Bytes every item treats alike
+** share a class, and each state maps a class to the next state, or to
+** accepting or failing without consuming. A transition also records the
+** range of optional items it passed over, whose failures the combinators
+** would have merged into the error, and the item it stopped at, whose
+** error is returned on failure. The combinator tree is kept for input
+** that is not a string.
+*/
+
+enum {
+  MPC_DFA_ACCEPT = -1,
+  MPC_DFA_FAIL   = -2
+};
+
+typedef struct {
+  int refs;
+  int states;
+  int classes;
+  int items;
+  int rewinds;
+  unsigned char bytes[256];
+  int *next;
+  int *passed;
+  char **expected;
+  char **failure;
+} mpc_dfa_t;
+
 typedef struct { char *m; } mpc_pdata_fail_t;
 typedef struct { mpc_ctor_t lf; void *x; } mpc_pdata_lift_t;
 typedef struct { mpc_parser_t *x; char *m; } mpc_pdata_expect_t;
@@ -934,6 +965,7 @@ typedef struct { mpc_parser_t *x; mpc_dtor_t dx; mpc_ctor_t lf; } mpc_pdata_not_
 typedef struct { int n; mpc_fold_t f; mpc_parser_t *x; mpc_dtor_t dx; } mpc_pdata_repeat_t;
 typedef struct { int n; mpc_parser_t **xs; } mpc_pdata_or_t;
 typedef struct { int n; mpc_fold_t f; mpc_parser_t **xs; mpc_dtor_t *dxs;  } mpc_pdata_and_t;
+typedef struct { mpc_parser_t *x; mpc_dfa_t *d; } mpc_pdata_dfa_t;
 
 typedef union {
   mpc_pdata_fail_t fail;
@@ -953,6 +985,7 @@ typedef union {
   mpc_pdata_repeat_t repeat;
   mpc_pdata_and_t and;
   mpc_pdata_or_t or;
+  mpc_pdata_dfa_t dfa;
 } mpc_pdata_t;
 
 struct mpc_parser_t {
@@ -1032,6 +1065,73 @@ static void mpc_parse_dtor(mpc_input_t *i, mpc_dtor_t d, mpc_val_t *x) {
   d(mpc_export(i, x));
 }
 
+static mpc_err_t *mpc_input_dfa_err(mpc_input_t *i, mpc_state_t at, char **expected, int n) {
+
+  int j;
+  mpc_err_t *x = NULL;
+  mpc_state_t st = i->state;
+
+  i->state = at;
+  for (j = 0; j < n; j++) {
+    if (!expected[j]) { continue; }
+    if (!x) { x = mpc_err_new(i, expected[j]); if (!x) { break; } }
+    else if (!mpc_err_contains_expected(i, x, expected[j])) { mpc_err_add_expected(i, x, expected[j]); }
+  }
+  i->state = st;
+
+  return x;
+}
+
+/* Returns -1 when the combinators must be run instead */
+static int mpc_input_dfa(mpc_input_t *i, mpc_dfa_t *d, mpc_result_t *r, mpc_err_t **e) {
+
+  int state = 0, t, lo = 0, hi = 0;
+  const char *start, *s, *c, *soft = NULL;
+  mpc_state_t at, st;
+
+  if (i->type != MPC_INPUT_STRING) { return -1; }
+
+  start = s = i->string + i->state.pos;
+
+  while (1) {
+    t = state * d->classes + d->bytes[(unsigned char)*s];
+    if (d->passed[t*2] != d->passed[t*2+1]) {
+      soft = s; lo = d->passed[t*2]; hi = d->passed[t*2+1];
+    }
+    state = d->next[t];
+    if (state < 0) { break; }
+    s++;
+  }
+
+  /* A repeat that is not inside an `and` keeps what it consumed when it fails */
+  if (state == MPC_DFA_FAIL && !d->rewinds && s > start) { return -1; }
+
+  st = at = i->state;
+  for (c = start; c < s; c++) {
+    if (c == soft) { at = st; }
+    st.pos++;
+    st.col++;
+    if (*c == '\n') { st.col = 0; st.row++; }
+  }
+  if (soft == s) { at = st; }
+
+  /* The optional items passed over last fail where the combinators would merge them */
+  if (soft) { *e = mpc_err_merge(i, *e, mpc_input_dfa_err(i, at, d->expected + lo, hi - lo)); }
+
+  if (state == MPC_DFA_FAIL) {
+    r->error = mpc_input_dfa_err(i, st, d->failure + d->passed[t*2+1], 1);
+    return 0;
+  }
+
+  i->state = st;
+  if (s > start) { i->last = s[-1]; }
+
+  r->output = mpc_malloc(i, (s - start) + 1);
+  memcpy(r->output, start, s - start);
+  ((char*)r->output)[s - start] = '\0';
+  return 1;
+}
+
 enum {
   MPC_PARSE_STACK_MIN = 4
 };
@@ -1130,6 +1230,10 @@ static int mpc_parse_run(mpc_input_t *i, mpc_parser_t *p, mpc_result_t *r, mpc_e
         MPC_FAILURE(mpc_err_new(i, p->data.expect.m));
       }
 
+    case MPC_TYPE_DFA:
+      j = mpc_input_dfa(i, p->data.dfa.d, r, e);
+      return j >= 0 ? j : mpc_parse_run(i, p->data.dfa.x, r, e, depth+1);
+
     case MPC_TYPE_PREDICT:
       mpc_input_backtrack_disable(i);
       if (mpc_parse_run(i, p->data.predict.x, r, e, depth+1)) {
@@ -1371,6 +1475,7 @@ int mpc_parse_contents(const char *filename, mpc_parser_t *p, mpc_result_t *r) {
 */
 
 static void mpc_undefine_unretained(mpc_parser_t *p, int force);
+static void mpc_dfa_release(mpc_dfa_t *d);
 
 static void mpc_undefine_or(mpc_parser_t *p) {
 
@@ -1411,6 +1516,11 @@ static void mpc_undefine_unretained(mpc_parser_t *p, int force) {
     case MPC_TYPE_APPLY_TO: mpc_undefine_unretained(p->data.apply_to.x, 0); break;
     case MPC_TYPE_PREDICT:  mpc_undefine_unretained(p->data.predict.x, 0);  break;
 
+    case MPC_TYPE_DFA:
+      mpc_undefine_unretained(p->data.dfa.x, 0);
+      mpc_dfa_release(p->data.dfa.d);
+      break;
+
     case MPC_TYPE_MAYBE:
     case MPC_TYPE_NOT:
       mpc_undefine_unretained(p->data.not.x, 0);
@@ -1519,6 +1629,11 @@ mpc_parser_t *mpc_copy(mpc_parser_t *a) {
     case MPC_TYPE_APPLY_TO: p->data.apply_to.x = mpc_copy(a->data.apply_to.x); break;
     case MPC_TYPE_PREDICT:  p->data.predict.x  = mpc_copy(a->data.predict.x);  break;
 
+    case MPC_TYPE_DFA:
+      p->data.dfa.x = mpc_copy(a->data.dfa.x);
+      p->data.dfa.d->refs++;
+      break;
+
     case MPC_TYPE_MAYBE:
     case MPC_TYPE_NOT:
       p->data.not.x = mpc_copy(a->data.not.x);
@@ -2350,16 +2465,307 @@ static mpc_val_t *mpcf_re_range(mpc_val_t *x) {
   return out;
 }
 
-mpc_parser_t *mpc_re(const char *re) {
-  return mpc_re_mode(re, MPC_RE_DEFAULT);
+/*
+** Compiling regexes to a DFA. Only sequences of character sets, each
+** matched once, optionally, or repeated, are compiled. Their repeats are
+** greedy and never give characters back, so every state knows what to do
+** with the next byte. Other regexes are left as combinators.
+*/
+
+enum {
+  MPC_DFA_MAX_ITEMS  = 256,
+  MPC_DFA_MAX_STATES = 1024
+};
+
+typedef struct {
+  int type;
+  int n;
+  char *expected;
+  char *failure;
+  unsigned char set[32];
+} mpc_dfa_item_t;
+
+static int mpc_dfa_set(mpc_parser_t *p, unsigned char *set) {
+
+  int b, j;
+  char c;
+
+  switch (p->type) {
+    case MPC_TYPE_EXPECT: return mpc_dfa_set(p->data.expect.x, set);
+    case MPC_TYPE_OR:
+      for (j = 0; j < p->data.or.n; j++) {
+        if (!mpc_dfa_set(p->data.or.xs[j], set)) { return 0; }
+      }
+      return p->data.or.n > 0;
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SINGLE:
+    case MPC_TYPE_RANGE:
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+    case MPC_TYPE_SATISFY:
+      break;
+    default: return 0;
+  }
+
+  /* The end of input never matches, so neither does the null byte */
+  for (b = 1; b < 256; b++) {
+    c = (char)b;
+    if ((p->type == MPC_TYPE_ANY)
+    ||  (p->type == MPC_TYPE_SINGLE  && c == p->data.single.x)
+    ||  (p->type == MPC_TYPE_RANGE   && c >= p->data.range.x && c <= p->data.range.y)
+    ||  (p->type == MPC_TYPE_ONEOF   && strchr(p->data.string.x, c) != 0)
+    ||  (p->type == MPC_TYPE_NONEOF  && strchr(p->data.string.x, c) == 0)
+    ||  (p->type == MPC_TYPE_SATISFY && p->data.satisfy.f(c))) {
+      set[b / 8] |= 1 << (b % 8);
+    }
+  }
+
+  return 1;
 }
 
-mpc_parser_t *mpc_re_mode(const char *re, int mode) {
+static int mpc_dfa_items(mpc_parser_t *p, mpc_dfa_item_t *items, int *n) {
+
+  int j;
+  mpc_parser_t *x = p;
+  mpc_dfa_item_t *item;
+
+  if (p->retained) { return 0; }
+
+  if (p->type == MPC_TYPE_AND && p->data.and.f == mpcf_strfold) {
+    for (j = 0; j < p->data.and.n; j++) {
+      if (!mpc_dfa_items(p->data.and.xs[j], items, n)) { return 0; }
+    }
+    return 1;
+  }
+
+  if (p->type == MPC_TYPE_LIFT && p->data.lift.lf == mpcf_ctor_str) { return 1; }
+
+  if (*n == MPC_DFA_MAX_ITEMS) { return 0; }
+  item = &items[*n];
+  memset(item, 0, sizeof(mpc_dfa_item_t));
+  item->type = MPC_TYPE_COUNT;
+  item->n = 1;
+
+  switch (p->type) {
+    case MPC_TYPE_MAYBE:
+      if (p->data.not.lf != mpcf_ctor_str) { return 0; }
+      item->type = p->type;
+      x = p->data.not.x;
+      break;
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      if (p->data.repeat.f != mpcf_strfold) { return 0; }
+      if (p->type == MPC_TYPE_COUNT && p->data.repeat.n < 1) { return 0; }
+      item->type = p->type;
+      item->n = p->data.repeat.n;
+      x = p->data.repeat.x;
+      break;
+    default: break;
+  }
+
+  /* An `or` merges the errors of the alternatives it tried unless an expect hides them */
+  if (x->retained || x->type == MPC_TYPE_OR || !mpc_dfa_set(x, item->set)) { return 0; }
+  item->expected = x->type == MPC_TYPE_EXPECT ? x->data.expect.m : NULL;
+
+  /* Errors of the repeats that can fail, as mpc_err_many1 and mpc_err_count word them */
+  if (item->expected && p->type != MPC_TYPE_MAYBE && p->type != MPC_TYPE_MANY) {
+    item->failure = malloc(strlen(item->expected) + 32);
+    if (p->type == MPC_TYPE_MANY1) { sprintf(item->failure, "one or more of %s", item->expected); }
+    else if (p->type == MPC_TYPE_COUNT) { sprintf(item->failure, "%i of %s", item->n, item->expected); }
+    else { strcpy(item->failure, item->expected); }
+  }
+
+  (*n)++;
+  return 1;
+}
+
+static int mpc_dfa_member(mpc_dfa_item_t *item, int b) {
+  return item->set[b / 8] & (1 << (b % 8));
+}
+
+static mpc_dfa_t *mpc_dfa_new(mpc_parser_t *p) {
+
+  int i, j, k, b, t, n = 0, states = 1;
+  int reps[256], *base;
+  mpc_dfa_item_t *items = malloc(sizeof(mpc_dfa_item_t) * MPC_DFA_MAX_ITEMS);
+  mpc_dfa_t *d;
+
+  if (!mpc_dfa_items(p, items, &n)) {
+    for (i = 0; i < n; i++) { free(items[i].failure); }
+    free(items);
+    return NULL;
+  }
+
+  /* Each item has a state for every count of it that matters, and the
+     last state accepts whatever comes next */
+  base = malloc(sizeof(int) * (n + 1));
+  for (i = 0; i < n; i++) {
+    base[i] = states - 1;
+    states += items[i].type == MPC_TYPE_COUNT ? items[i].n
+            : items[i].type == MPC_TYPE_MANY1 ? 2 : 1;
+    if (states > MPC_DFA_MAX_STATES) {
+      for (i = 0; i < n; i++) { free(items[i].failure); }
+      free(base); free(items);
+      return NULL;
+    }
+  }
+  base[n] = states - 1;
+
+  d = malloc(sizeof(mpc_dfa_t));
+  d->refs = 1;
+  d->states = states;
+  d->items = n;
+  d->rewinds = p->type == MPC_TYPE_AND;
+  d->classes = 0;
+
+  for (b = 0; b < 256; b++) {
+    for (k = 0; k < d->classes; k++) {
+      for (i = 0; i < n; i++) {
+        if (!mpc_dfa_member(&items[i], b) != !mpc_dfa_member(&items[i], reps[k])) { break; }
+      }
+      if (i == n) { break; }
+    }
+    if (k == d->classes) { reps[d->classes++] = b; }
+    d->bytes[b] = k;
+  }
+
+  d->next = malloc(sizeof(int) * states * d->classes);
+  d->passed = malloc(sizeof(int) * states * d->classes * 2);
+  d->expected = malloc(sizeof(char*) * (n + 1));
+  d->failure = malloc(sizeof(char*) * (n + 1));
+
+  for (i = 0; i < n; i++) {
+    d->expected[i] = NULL;
+    d->failure[i] = items[i].failure;
+    if (items[i].expected) {
+      d->expected[i] = malloc(strlen(items[i].expected) + 1);
+      strcpy(d->expected[i], items[i].expected);
+    }
+  }
+
+  /* Follow the items from each state, passing over those that are
+     satisfied and do not take the byte, until one takes it or fails */
+  for (j = 0; j <= n; j++) {
+    for (k = 0; k < (j < n ? base[j+1] - base[j] : 1); k++) {
+      for (b = 0; b < d->classes; b++) {
+
+        t = (base[j] + k) * d->classes + b;
+        i = j;
+
+        while (1) {
+          if (i == n) { d->next[t] = MPC_DFA_ACCEPT; break; }
+          if (mpc_dfa_member(&items[i], reps[b])) {
+            if (items[i].type == MPC_TYPE_COUNT) {
+              d->next[t] = (i == j ? k : 0) + 1 == items[i].n ? base[i+1] : base[i] + (i == j ? k : 0) + 1;
+            } else if (items[i].type == MPC_TYPE_MAYBE) {
+              d->next[t] = base[i+1];
+            } else if (items[i].type == MPC_TYPE_MANY) {
+              d->next[t] = base[i];
+            } else {
+              d->next[t] = base[i] + 1;
+            }
+            break;
+          }
+          if (items[i].type == MPC_TYPE_COUNT
+          || (items[i].type == MPC_TYPE_MANY1 && (i != j || k == 0))) {
+            d->next[t] = MPC_DFA_FAIL;
+            break;
+          }
+          i++;
+        }
+
+        d->passed[t*2+0] = j;
+        d->passed[t*2+1] = i;
+      }
+    }
+  }
+
+  free(base);
+  free(items);
+  return d;
+}
+
+static void mpc_dfa_release(mpc_dfa_t *d) {
+  int i;
+  if (d == NULL || --d->refs > 0) { return; }
+  for (i = 0; i < d->items; i++) { free(d->expected[i]); free(d->failure[i]); }
+  free(d->expected);
+  free(d->failure);
+  free(d->next);
+  free(d->passed);
+  free(d);
+}
+
+static mpc_parser_t *mpc_re_dfa(mpc_parser_t *a) {
+  mpc_parser_t *p;
+  mpc_dfa_t *d = mpc_dfa_new(a);
+  if (d == NULL) { return a; }
+  p = mpc_undefined();
+  p->type = MPC_TYPE_DFA;
+  p->data.dfa.x = a;
+  p->data.dfa.d = d;
+  return p;
+}
+
+/*
+** The regex grammar only depends on the mode, so one is built for each
+** mode the first time it is needed and kept. Compiled patterns are kept
+** too, keyed by pattern and mode. Callers own the parser they are given
+** and fold it into their own graphs, so each call returns a copy of the
+** cached parser, which is far cheaper than compiling the pattern again.
+*/
+
+enum { MPC_RE_MODES = 4 };
+
+static int mpc_re_modes[MPC_RE_MODES] = {
+  MPC_RE_DEFAULT, MPC_RE_MULTILINE, MPC_RE_DOTALL, MPC_RE_MULTILINE | MPC_RE_DOTALL };
+
+static mpc_parser_t *mpc_re_grammars[MPC_RE_MODES][6];
+
+typedef struct mpc_re_cached_t {
+  char *re;
+  int mode;
+  unsigned long hash;
+  mpc_parser_t *p;
+  struct mpc_re_cached_t *next;
+} mpc_re_cached_t;
+
+static mpc_re_cached_t **mpc_re_cache = NULL;
+static int mpc_re_cache_num = 0;
+static int mpc_re_cache_size = 0;
+
+static unsigned long mpc_re_hash(const char *re, int mode) {
+  unsigned long h = 5381 + mode;
+  while (*re) { h = h * 33 + (unsigned char)*re++; }
+  return h;
+}
+
+static void mpc_re_cache_grow(void) {
+
+  int i, size = mpc_re_cache_size ? mpc_re_cache_size * 2 : 64;
+  mpc_re_cached_t **cache = calloc(size, sizeof(mpc_re_cached_t*));
+  mpc_re_cached_t *c, *next;
+
+  for (i = 0; i < mpc_re_cache_size; i++) {
+    for (c = mpc_re_cache[i]; c; c = next) {
+      next = c->next;
+      c->next = cache[c->hash % size];
+      cache[c->hash % size] = c;
+    }
+  }
+
+  free(mpc_re_cache);
+  mpc_re_cache = cache;
+  mpc_re_cache_size = size;
+}
+
+static mpc_parser_t *mpc_re_grammar(int mode) {
 
-  char *err_msg;
-  mpc_parser_t *err_out;
-  mpc_result_t r;
   mpc_parser_t *Regex, *Term, *Factor, *Base, *Range, *RegexEnclose;
+  mpc_parser_t **g = mpc_re_grammars[mode];
+
+  if (g[0]) { return g[0]; }
 
   Regex  = mpc_new("regex");
   Term   = mpc_new("term");
@@ -2387,8 +2793,8 @@ mpc_parser_t *mpc_re_mode(const char *re, int mode) {
   mpc_define(Base, mpc_or(4,
     mpc_parens(Regex, (mpc_dtor_t)mpc_delete),
     mpc_squares(Range, (mpc_dtor_t)mpc_delete),
-    mpc_apply_to(mpc_escape(), mpcf_re_escape, &mode),
-    mpc_apply_to(mpc_noneof(")|"), mpcf_re_escape, &mode)
+    mpc_apply_to(mpc_escape(), mpcf_re_escape, &mpc_re_modes[mode]),
+    mpc_apply_to(mpc_noneof(")|"), mpcf_re_escape, &mpc_re_modes[mode])
   ));
 
   mpc_define(Range, mpc_apply(
@@ -2405,7 +2811,36 @@ mpc_parser_t *mpc_re_mode(const char *re, int mode) {
   mpc_optimise(Base);
   mpc_optimise(Range);
 
-  if(!mpc_parse("<mpc_re_compiler>", re, RegexEnclose, &r)) {
+  g[0] = RegexEnclose; g[1] = Regex; g[2] = Term;
+  g[3] = Factor; g[4] = Base; g[5] = Range;
+
+  return RegexEnclose;
+}
+
+mpc_parser_t *mpc_re(const char *re) {
+  return mpc_re_mode(re, MPC_RE_DEFAULT);
+}
+
+mpc_parser_t *mpc_re_mode(const char *re, int mode) {
+
+  char *err_msg;
+  mpc_parser_t *err_out;
+  mpc_result_t r;
+  mpc_re_cached_t *c;
+  unsigned long hash;
+
+  mode &= MPC_RE_MULTILINE | MPC_RE_DOTALL;
+  hash = mpc_re_hash(re, mode);
+
+  if (mpc_re_cache_size) {
+    for (c = mpc_re_cache[hash % mpc_re_cache_size]; c; c = c->next) {
+      if (c->hash == hash && c->mode == mode && strcmp(c->re, re) == 0) {
+        return mpc_copy(c->p);
+      }
+    }
+  }
+
+  if(!mpc_parse("<mpc_re_compiler>", re, mpc_re_grammar(mode), &r)) {
     err_msg = mpc_err_string(r.error);
     err_out = mpc_failf("Invalid Regex: %s", err_msg);
     mpc_err_delete(r.error);
@@ -2413,11 +2848,50 @@ mpc_parser_t *mpc_re_mode(const char *re, int mode) {
     r.output = err_out;
   }
 
-  mpc_cleanup(6, RegexEnclose, Regex, Term, Factor, Base, Range);
-
   mpc_optimise(r.output);
+  r.output = mpc_re_dfa(r.output);
+
+  if (mpc_re_cache_num >= mpc_re_cache_size) { mpc_re_cache_grow(); }
+
+  c = malloc(sizeof(mpc_re_cached_t));
+  c->re = malloc(strlen(re) + 1);
+  strcpy(c->re, re);
+  c->mode = mode;
+  c->hash = hash;
+  c->p = r.output;
+  c->next = mpc_re_cache[hash % mpc_re_cache_size];
+  mpc_re_cache[hash % mpc_re_cache_size] = c;
+  mpc_re_cache_num++;
 
-  return r.output;
+  return mpc_copy(c->p);
+
+}
+
+void mpc_re_cleanup(void) {
+
+  int i;
+  mpc_parser_t **g;
+  mpc_re_cached_t *c, *next;
+
+  for (i = 0; i < mpc_re_cache_size; i++) {
+    for (c = mpc_re_cache[i]; c; c = next) {
+      next = c->next;
+      free(c->re);
+      mpc_delete(c->p);
+      free(c);
+    }
+  }
+  free(mpc_re_cache);
+  mpc_re_cache = NULL;
+  mpc_re_cache_num = 0;
+  mpc_re_cache_size = 0;
+
+  for (i = 0; i < MPC_RE_MODES; i++) {
+    g = mpc_re_grammars[i];
+    if (!g[0]) { continue; }
+    mpc_cleanup(6, g[0], g[1], g[2], g[3], g[4], g[5]);
+    memset(g, 0, sizeof(mpc_re_grammars[i]));
+  }
 
 }
 
@@ -2769,6 +3243,7 @@ static void mpc_print_unretained(mpc_parser_t *p, int force) {
   if (p->type == MPC_TYPE_APPLY)    { mpc_print_unretained(p->data.apply.x, 0); }
   if (p->type == MPC_TYPE_APPLY_TO) { mpc_print_unretained(p->data.apply_to.x, 0); }
   if (p->type == MPC_TYPE_PREDICT)  { mpc_print_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)      { mpc_print_unretained(p->data.dfa.x, 0); }
 
   if (p->type == MPC_TYPE_NOT)   { mpc_print_unretained(p->data.not.x, 0); printf("!"); }
   if (p->type == MPC_TYPE_MAYBE) { mpc_print_unretained(p->data.not.x, 0); printf("?"); }
@@ -3855,6 +4330,7 @@ static int mpc_nodecount_unretained(mpc_parser_t* p, int force) {
   if (p->type == MPC_TYPE_APPLY)    { return 1 + mpc_nodecount_unretained(p->data.apply.x, 0); }
   if (p->type == MPC_TYPE_APPLY_TO) { return 1 + mpc_nodecount_unretained(p->data.apply_to.x, 0); }
   if (p->type == MPC_TYPE_PREDICT)  { return 1 + mpc_nodecount_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)      { return 1 + mpc_nodecount_unretained(p->data.dfa.x, 0); }
 
   if (p->type == MPC_TYPE_CHECK)    { return 1 + mpc_nodecount_unretained(p->data.check.x, 0); }
   if (p->type == MPC_TYPE_CHECK_WITH) { return 1 + mpc_nodecount_unretained(p->data.check_with.x, 0); }
@@ -3907,6 +4383,7 @@ static void mpc_optimise_unretained(mpc_parser_t *p, int force) {
   if (p->type == MPC_TYPE_CHECK)      { mpc_optimise_unretained(p->data.check.x, 0); }
   if (p->type == MPC_TYPE_CHECK_WITH) { mpc_optimise_unretained(p->data.check_with.x, 0); }
   if (p->type == MPC_TYPE_PREDICT)    { mpc_optimise_unretained(p->data.predict.x, 0); }
+  if (p->type == MPC_TYPE_DFA)        { mpc_optimise_unretained(p->data.dfa.x, 0); }
   if (p->type == MPC_TYPE_NOT)        { mpc_optimise_unretained(p->data.not.x, 0); }
   if (p->type == MPC_TYPE_MAYBE)      { mpc_optimise_unretained(p->data.not.x, 0); }
   if (p->type == MPC_TYPE_MANY)       { mpc_optimise_unretained(p->data.repeat.x, 0); }
@@ -4065,3 +4542,432 @@ void mpc_optimise(mpc_parser_t *p) {
   mpc_optimise_unretained(p, 1);
 }
 
+
+/*
+** Serialisation
+**
+** A parser graph is written depth first. Every reference is either
+** a new parser, written out in full, or the index of a retained parser
+** written earlier, which is how recursive grammars are closed. Function
+** pointers are written as indices into the functions mpc itself uses
+** followed by those the caller passes, so a saved grammar can be loaded
+** by any process built from the same code. The blob ends with a checksum
+** of the rest, a graph that only looks well formed is never loaded.
+*/
+
+static mpc_fn_t mpc_saved_fns[] = {
+  (mpc_fn_t)free, (mpc_fn_t)mpc_soft_delete, (mpc_fn_t)mpc_boundary_anchor, (mpc_fn_t)mpc_boundary_newline_anchor,
+  (mpc_fn_t)mpcf_dtor_null, (mpc_fn_t)mpcf_ctor_null, (mpc_fn_t)mpcf_ctor_str,
+  (mpc_fn_t)mpcf_free, (mpc_fn_t)mpcf_int, (mpc_fn_t)mpcf_hex, (mpc_fn_t)mpcf_oct, (mpc_fn_t)mpcf_float,
+  (mpc_fn_t)mpcf_strtriml, (mpc_fn_t)mpcf_strtrimr, (mpc_fn_t)mpcf_strtrim,
+  (mpc_fn_t)mpcf_escape, (mpc_fn_t)mpcf_escape_regex, (mpc_fn_t)mpcf_escape_string_raw, (mpc_fn_t)mpcf_escape_char_raw,
+  (mpc_fn_t)mpcf_unescape, (mpc_fn_t)mpcf_unescape_regex, (mpc_fn_t)mpcf_unescape_string_raw, (mpc_fn_t)mpcf_unescape_char_raw,
+  (mpc_fn_t)mpcf_null, (mpc_fn_t)mpcf_fst, (mpc_fn_t)mpcf_snd, (mpc_fn_t)mpcf_trd,
+  (mpc_fn_t)mpcf_fst_free, (mpc_fn_t)mpcf_snd_free, (mpc_fn_t)mpcf_trd_free, (mpc_fn_t)mpcf_all_free,
+  (mpc_fn_t)mpcf_strfold, (mpc_fn_t)mpcf_maths,
+  (mpc_fn_t)mpcf_fold_ast, (mpc_fn_t)mpcf_str_ast, (mpc_fn_t)mpcf_state_ast,
+  (mpc_fn_t)mpc_ast_add_root, (mpc_fn_t)mpc_ast_add_tag, (mpc_fn_t)mpc_ast_add_root_tag, (mpc_fn_t)mpc_ast_tag,
+  (mpc_fn_t)mpc_ast_delete
+};
+
+#define MPC_SAVED_FNS ((int)(sizeof(mpc_saved_fns) / sizeof(mpc_fn_t)))
+
+typedef struct {
+  char *data;
+  size_t len;
+  size_t capacity;
+  int count;
+  mpc_parser_t **retained;
+  int fn_count;
+  mpc_fn_t *fns;
+} mpc_saver_t;
+
+static void mpc_save_bytes(mpc_saver_t *s, const void *x, size_t n) {
+  if (s->len + n > s->capacity) {
+    while (s->len + n > s->capacity) { s->capacity = s->capacity ? s->capacity * 2 : 256; }
+    s->data = realloc(s->data, s->capacity);
+  }
+  memcpy(s->data + s->len, x, n);
+  s->len += n;
+}
+
+static void mpc_save_int(mpc_saver_t *s, long x) {
+  unsigned char b[4];
+  b[0] = x & 0xFF; b[1] = (x >> 8) & 0xFF; b[2] = (x >> 16) & 0xFF; b[3] = (x >> 24) & 0xFF;
+  mpc_save_bytes(s, b, 4);
+}
+
+static void mpc_checksum(const char *x, size_t n, unsigned char *sum) {
+  unsigned long h = 2166136261UL;
+  size_t i;
+  for (i = 0; i < n; i++) { h = ((h ^ (unsigned char)x[i]) * 16777619UL) & 0xFFFFFFFFUL; }
+  sum[0] = h & 0xFF; sum[1] = (h >> 8) & 0xFF; sum[2] = (h >> 16) & 0xFF; sum[3] = (h >> 24) & 0xFF;
+}
+
+static void mpc_save_str(mpc_saver_t *s, const char *x) {
+  if (x == NULL) { mpc_save_int(s, -1); return; }
+  mpc_save_int(s, (long)strlen(x));
+  mpc_save_bytes(s, x, strlen(x) + 1);
+}
+
+static int mpc_save_fn(mpc_saver_t *s, mpc_fn_t f) {
+  int i;
+  if (f == NULL) { mpc_save_int(s, -1); return 1; }
+  for (i = 0; i < MPC_SAVED_FNS; i++) {
+    if (mpc_saved_fns[i] == f) { mpc_save_int(s, i); return 1; }
+  }
+  for (i = 0; i < s->fn_count; i++) {
+    if (s->fns[i] == f) { mpc_save_int(s, MPC_SAVED_FNS + i); return 1; }
+  }
+  return 0;
+}
+
+static int mpc_save_parser(mpc_saver_t *s, mpc_parser_t *p) {
+
+  int i;
+  char type = p->type;
+
+  if (p->retained) {
+    for (i = 0; i < s->count; i++) {
+      if (s->retained[i] == p) { mpc_save_int(s, i); return 1; }
+    }
+    s->retained = realloc(s->retained, sizeof(mpc_parser_t*) * (s->count + 1));
+    s->retained[s->count++] = p;
+  }
+
+  mpc_save_int(s, -1);
+  mpc_save_bytes(s, &p->retained, 1);
+  mpc_save_bytes(s, &type, 1);
+  mpc_save_str(s, p->name);
+
+  switch (p->type) {
+
+    case MPC_TYPE_FAIL: mpc_save_str(s, p->data.fail.m); return 1;
+
+    case MPC_TYPE_LIFT:
+      return mpc_save_fn(s, (mpc_fn_t)p->data.lift.lf);
+    case MPC_TYPE_LIFT_VAL:
+      return p->data.lift.x == NULL;
+
+    case MPC_TYPE_EXPECT:
+      mpc_save_str(s, p->data.expect.m);
+      return mpc_save_parser(s, p->data.expect.x);
+
+    case MPC_TYPE_ANCHOR: return mpc_save_fn(s, (mpc_fn_t)p->data.anchor.f);
+    case MPC_TYPE_SATISFY: return mpc_save_fn(s, (mpc_fn_t)p->data.satisfy.f);
+
+    case MPC_TYPE_SINGLE: mpc_save_bytes(s, &p->data.single.x, 1); return 1;
+    case MPC_TYPE_RANGE:
+      mpc_save_bytes(s, &p->data.range.x, 1);
+      mpc_save_bytes(s, &p->data.range.y, 1);
+      return 1;
+
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+    case MPC_TYPE_STRING:
+      mpc_save_str(s, p->data.string.x);
+      return 1;
+
+    case MPC_TYPE_APPLY:
+      return mpc_save_fn(s, (mpc_fn_t)p->data.apply.f) && mpc_save_parser(s, p->data.apply.x);
+
+    case MPC_TYPE_APPLY_TO:
+      /* Only tags are known to be strings */
+      if (p->data.apply_to.f != (mpc_apply_to_t)mpc_ast_tag
+        && p->data.apply_to.f != (mpc_apply_to_t)mpc_ast_add_tag
+        && p->data.apply_to.f != (mpc_apply_to_t)mpc_ast_add_root_tag) { return 0; }
+      if (p->data.apply_to.d == NULL) { return 0; }
+      mpc_save_str(s, p->data.apply_to.d);
+      return mpc_save_fn(s, (mpc_fn_t)p->data.apply_to.f) && mpc_save_parser(s, p->data.apply_to.x);
+
+    case MPC_TYPE_CHECK:
+      mpc_save_str(s, p->data.check.e);
+      return mpc_save_fn(s, (mpc_fn_t)p->data.check.dx)
+        && mpc_save_fn(s, (mpc_fn_t)p->data.check.f)
+        && mpc_save_parser(s, p->data.check.x);
+
+    case MPC_TYPE_PREDICT: return mpc_save_parser(s, p->data.predict.x);
+
+    /* The tables are compiled again from the tree when loaded */
+    case MPC_TYPE_DFA: return mpc_save_parser(s, p->data.dfa.x);
+
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_NOT:
+      return mpc_save_fn(s, (mpc_fn_t)p->data.not.dx)
+        && mpc_save_fn(s, (mpc_fn_t)p->data.not.lf)
+        && mpc_save_parser(s, p->data.not.x);
+
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      mpc_save_int(s, p->data.repeat.n);
+      return mpc_save_fn(s, (mpc_fn_t)p->data.repeat.f)
+        && mpc_save_fn(s, (mpc_fn_t)p->data.repeat.dx)
+        && mpc_save_parser(s, p->data.repeat.x);
+
+    case MPC_TYPE_OR:
+      mpc_save_int(s, p->data.or.n);
+      for (i = 0; i < p->data.or.n; i++) {
+        if (!mpc_save_parser(s, p->data.or.xs[i])) { return 0; }
+      }
+      return 1;
+
+    case MPC_TYPE_AND:
+      mpc_save_int(s, p->data.and.n);
+      if (!mpc_save_fn(s, (mpc_fn_t)p->data.and.f)) { return 0; }
+      for (i = 0; i < p->data.and.n; i++) {
+        if (!mpc_save_parser(s, p->data.and.xs[i])) { return 0; }
+        if (i < p->data.and.n-1 && !mpc_save_fn(s, (mpc_fn_t)p->data.and.dxs[i])) { return 0; }
+      }
+      return 1;
+
+    case MPC_TYPE_UNDEFINED:
+    case MPC_TYPE_PASS:
+    case MPC_TYPE_STATE:
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SOI:
+    case MPC_TYPE_EOI:
+      return 1;
+
+    default: return 0;
+  }
+
+}
+
+int mpc_save(int n, mpc_parser_t **ps, int fn_count, mpc_fn_t *fns, char **blob, size_t *len) {
+
+  int i;
+  unsigned char sum[4];
+  mpc_saver_t s;
+  s.data = NULL; s.len = 0; s.capacity = 0;
+  s.count = 0; s.retained = NULL;
+  s.fn_count = fn_count; s.fns = fns;
+
+  mpc_save_bytes(&s, "mpc2", 4);
+  mpc_save_int(&s, MPC_SAVED_FNS + fn_count);
+  mpc_save_int(&s, n);
+
+  for (i = 0; i < n; i++) {
+    if (!mpc_save_parser(&s, ps[i])) {
+      free(s.data); free(s.retained);
+      return 0;
+    }
+  }
+
+  mpc_checksum(s.data, s.len, sum);
+  mpc_save_bytes(&s, sum, 4);
+
+  free(s.retained);
+  *blob = s.data;
+  *len = s.len;
+  return 1;
+}
+
+typedef struct {
+  const unsigned char *data;
+  size_t len;
+  size_t pos;
+  int failed;
+  int count;
+  mpc_parser_t **retained;
+  int fn_count;
+  mpc_fn_t *fns;
+} mpc_loader_t;
+
+static long mpc_load_int(mpc_loader_t *l) {
+  const unsigned char *b;
+  unsigned long x;
+  if (l->pos + 4 > l->len) { l->failed = 1; return -1; }
+  b = l->data + l->pos;
+  l->pos += 4;
+  x = b[0] | (b[1] << 8) | ((unsigned long)b[2] << 16) | ((unsigned long)b[3] << 24);
+  return x >= 0x80000000UL ? (long)x - 0x100000000L : (long)x;
+}
+
+static char mpc_load_char(mpc_loader_t *l) {
+  if (l->pos + 1 > l->len) { l->failed = 1; return 0; }
+  return (char)l->data[l->pos++];
+}
+
+static char *mpc_load_str(mpc_loader_t *l) {
+  char *x;
+  long n = mpc_load_int(l);
+  if (n < 0 || l->failed) { return NULL; }
+  if (l->pos + (size_t)n + 1 > l->len || l->data[l->pos + n] != '\0') { l->failed = 1; return NULL; }
+  x = malloc(n + 1);
+  memcpy(x, l->data + l->pos, n + 1);
+  l->pos += n + 1;
+  return x;
+}
+
+static mpc_fn_t mpc_load_fn(mpc_loader_t *l) {
+  long i = mpc_load_int(l);
+  if (i < 0 || l->failed) { return NULL; }
+  if (i < MPC_SAVED_FNS) { return mpc_saved_fns[i]; }
+  if (i < MPC_SAVED_FNS + l->fn_count) { return l->fns[i - MPC_SAVED_FNS]; }
+  l->failed = 1;
+  return NULL;
+}
+
+static mpc_parser_t *mpc_load_parser(mpc_loader_t *l) {
+
+  int i;
+  char *tag;
+  mpc_parser_t *p;
+  long ref = mpc_load_int(l);
+
+  if (l->failed) { return mpc_undefined(); }
+  if (ref >= 0) {
+    if (ref < l->count) { return l->retained[ref]; }
+    l->failed = 1;
+    return mpc_undefined();
+  }
+
+  p = mpc_undefined();
+  p->retained = mpc_load_char(l);
+  p->type = mpc_load_char(l);
+  p->name = mpc_load_str(l);
+
+  if (p->retained) {
+    l->retained = realloc(l->retained, sizeof(mpc_parser_t*) * (l->count + 1));
+    l->retained[l->count++] = p;
+  }
+
+  switch (p->type) {
+
+    case MPC_TYPE_FAIL: p->data.fail.m = mpc_load_str(l); break;
+
+    case MPC_TYPE_LIFT: p->data.lift.lf = (mpc_ctor_t)mpc_load_fn(l); break;
+    case MPC_TYPE_LIFT_VAL: p->data.lift.x = NULL; break;
+
+    case MPC_TYPE_EXPECT:
+      p->data.expect.m = mpc_load_str(l);
+      p->data.expect.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_ANCHOR: p->data.anchor.f = (int(*)(char,char))mpc_load_fn(l); break;
+    case MPC_TYPE_SATISFY: p->data.satisfy.f = (int(*)(char))mpc_load_fn(l); break;
+
+    case MPC_TYPE_SINGLE: p->data.single.x = mpc_load_char(l); break;
+    case MPC_TYPE_RANGE:
+      p->data.range.x = mpc_load_char(l);
+      p->data.range.y = mpc_load_char(l);
+      break;
+
+    case MPC_TYPE_ONEOF:
+    case MPC_TYPE_NONEOF:
+    case MPC_TYPE_STRING:
+      p->data.string.x = mpc_load_str(l);
+      break;
+
+    case MPC_TYPE_APPLY:
+      p->data.apply.f = (mpc_apply_t)mpc_load_fn(l);
+      p->data.apply.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_APPLY_TO:
+      /* Tags point into the blob rather than being owned by the parser */
+      p->data.apply_to.d = (void*)(l->data + l->pos + 4);
+      tag = mpc_load_str(l);
+      if (tag == NULL) { l->failed = 1; p->data.apply_to.d = NULL; }
+      free(tag);
+      p->data.apply_to.f = (mpc_apply_to_t)mpc_load_fn(l);
+      p->data.apply_to.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_CHECK:
+      p->data.check.e = mpc_load_str(l);
+      p->data.check.dx = (mpc_dtor_t)mpc_load_fn(l);
+      p->data.check.f = (mpc_check_t)mpc_load_fn(l);
+      p->data.check.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_PREDICT: p->data.predict.x = mpc_load_parser(l); break;
+
+    case MPC_TYPE_DFA:
+      p->data.dfa.x = mpc_load_parser(l);
+      p->data.dfa.d = l->failed ? NULL : mpc_dfa_new(p->data.dfa.x);
+      if (p->data.dfa.d == NULL) { l->failed = 1; }
+      break;
+
+    case MPC_TYPE_MAYBE:
+    case MPC_TYPE_NOT:
+      p->data.not.dx = (mpc_dtor_t)mpc_load_fn(l);
+      p->data.not.lf = (mpc_ctor_t)mpc_load_fn(l);
+      p->data.not.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_MANY:
+    case MPC_TYPE_MANY1:
+    case MPC_TYPE_COUNT:
+      p->data.repeat.n = (int)mpc_load_int(l);
+      p->data.repeat.f = (mpc_fold_t)mpc_load_fn(l);
+      p->data.repeat.dx = (mpc_dtor_t)mpc_load_fn(l);
+      p->data.repeat.x = mpc_load_parser(l);
+      break;
+
+    case MPC_TYPE_OR:
+      p->data.or.n = (int)mpc_load_int(l);
+      if (l->failed || p->data.or.n < 0) { l->failed = 1; p->data.or.n = 0; }
+      p->data.or.xs = malloc(sizeof(mpc_parser_t*) * (p->data.or.n + 1));
+      for (i = 0; i < p->data.or.n; i++) { p->data.or.xs[i] = mpc_load_parser(l); }
+      break;
+
+    case MPC_TYPE_AND:
+      p->data.and.n = (int)mpc_load_int(l);
+      if (l->failed || p->data.and.n < 1) { l->failed = 1; p->data.and.n = 1; }
+      p->data.and.f = (mpc_fold_t)mpc_load_fn(l);
+      p->data.and.xs = malloc(sizeof(mpc_parser_t*) * p->data.and.n);
+      p->data.and.dxs = malloc(sizeof(mpc_dtor_t) * p->data.and.n);
+      for (i = 0; i < p->data.and.n; i++) {
+        p->data.and.xs[i] = mpc_load_parser(l);
+        if (i < p->data.and.n-1) { p->data.and.dxs[i] = (mpc_dtor_t)mpc_load_fn(l); }
+      }
+      break;
+
+    case MPC_TYPE_UNDEFINED:
+    case MPC_TYPE_PASS:
+    case MPC_TYPE_STATE:
+    case MPC_TYPE_ANY:
+    case MPC_TYPE_SOI:
+    case MPC_TYPE_EOI:
+      break;
+
+    default:
+      l->failed = 1;
+      p->type = MPC_TYPE_UNDEFINED;
+      break;
+  }
+
+  return p;
+}
+
+int mpc_load(const char *blob, size_t len, int n, mpc_parser_t **ps, int fn_count, mpc_fn_t *fns) {
+
+  int i;
+  unsigned char sum[4];
+  mpc_loader_t l;
+  l.data = (const unsigned char*)blob; l.len = len - 4; l.pos = 0; l.failed = 0;
+  l.count = 0; l.retained = NULL;
+  l.fn_count = fn_count; l.fns = fns;
+
+  if (len < 16 || memcmp(blob, "mpc2", 4) != 0) { return 0; }
+  mpc_checksum(blob, len - 4, sum);
+  if (memcmp(blob + len - 4, sum, 4) != 0) { return 0; }
+  l.pos = 4;
+  if (mpc_load_int(&l) != MPC_SAVED_FNS + fn_count || mpc_load_int(&l) != n) { return 0; }
+
+  for (i = 0; i < n; i++) { ps[i] = mpc_load_parser(&l); }
+
+  /* A partial graph is still well formed, delete it as a whole */
+  if (l.failed) {
+    for (i = 0; i < l.count; i++) { mpc_undefine(l.retained[i]); }
+    for (i = 0; i < n; i++) { if (!ps[i]->retained) { mpc_delete(ps[i]); } }
+    for (i = 0; i < l.count; i++) { mpc_delete(l.retained[i]); }
+    free(l.retained);
+    return 0;
+  }
+
+  free(l.retained);
+  return 1;
+}
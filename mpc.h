@@ -85,6 +85,8 @@ typedef mpc_val_t*(*mpc_fold_t)(int,mpc_val_t**);
 typedef int(*mpc_check_t)(mpc_val_t**);
 typedef int(*mpc_check_with_t)(mpc_val_t**,void*);
 
+typedef void(*mpc_fn_t)(void); /* Any of the above, as listed for mpc_save */
+
 /*
 ** Building a Parser
 */
@@ -277,6 +279,9 @@ enum {
 mpc_parser_t *mpc_re(const char *re);
 mpc_parser_t *mpc_re_mode(const char *re, int mode);
 
+/* Frees the regex grammars and compiled patterns mpc_re keeps */
+void mpc_re_cleanup(void);
+
 /*
 ** AST
 */
@@ -373,6 +378,18 @@ void mpc_print(mpc_parser_t *p);
 void mpc_optimise(mpc_parser_t *p);
 void mpc_stats(mpc_parser_t *p);
 
+/*
+** Serialisation
+**
+** mpc_save writes the graphs of n parsers to a malloc'd blob. fns lists
+** the caller's functions the parsers may refer to, a load must pass the
+** same ones. mpc_load rebuilds the parsers in ps, tag strings point into
+** the blob so it must outlive them. Both return 0 on failure.
+*/
+
+int mpc_save(int n, mpc_parser_t **ps, int fn_count, mpc_fn_t *fns, char **blob, size_t *len);
+int mpc_load(const char *blob, size_t len, int n, mpc_parser_t **ps, int fn_count, mpc_fn_t *fns);
+
 int mpc_test_pass(mpc_parser_t *p, const char *s, const void *d,
   int(*tester)(const void*, const void*),
   mpc_dtor_t destructor,
@@ -1,9 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <limits.h>
 #include "mpc.h"
 
-#define LASSERT(args, cond, err)\
-  if (!(cond)) { lval_del(args); return lval_err(err); }
+#define LASSERT(cond, err)\
+  if (!(cond)) { return lval_err(err); }
 
 #ifdef _WIN32
 #include <string.h>
@@ -37,47 +40,208 @@ void add_history(char* unused);
 /* Forward declare structs */
 struct lval;
 struct lenv;
+struct lvec;
+struct lcode;
 
 typedef struct lval lval;
 typedef struct lenv lenv;
-
-/*  */
-typedef lval* (*lbuiltin) (lval*, lenv*);
-
-/* Declare a lisp val struct to help with error handling */
+typedef struct lvec lvec;
+
+/* An interned symbol, there is exactly one per distinct name so symbols
+   compare by pointer. */
+typedef struct lsym {
+  unsigned long hash;		/* Precomputed hash of name, never 0 */
+  long rebound;			/* fold.epoch when a builtin bound to it was last replaced */
+  char name[];			/* The symbol's name */
+} lsym;
+
+/* A builtin borrows its arguments, it takes one over by setting it to NULL */
+typedef lval* (*lbuiltin_fn) (lval** args, int argc, lenv* env);
+
+/* A builtin's registration. Its arity and argument types are checked
+   before it is called, so the builtin only checks what is left. */
+typedef struct lbuiltin {
+  char* name;			/* Symbol it is bound to */
+  lbuiltin_fn call;
+  int flags;			/* LB_* bits */
+  int min_args;
+  int max_args;			/* -1 for any number */
+  char* types;			/* Type of each argument, the last repeats: n number, q Q-expression, * any */
+  char* arity_err;
+  char* type_err;
+} lbuiltin;
+
+#define LB_PURE 1		/* Only computes its result, calls on constants may be folded */
+#define LB_SPECIAL 2		/* Gets its operands unevaluated and evaluates them itself */
+
+/* A user defined function. Formals and captured variables are resolved
+   to slots when the lambda is made, so calls never look them up by name. */
+typedef struct llambda {
+  int refs;
+  int params;			/* Formals, bound to the frame's slots 0 .. params-1 */
+  int captured;			/* Free variables, copied in when the lambda is made */
+  lsym** names;			/* Names of the formals then of the captured variables */
+  lval** free;			/* The captured values */
+  lval* formals;		/* Kept to print the lambda */
+  lval* body;
+  struct lcode* code;		/* The compiled body */
+  long marked;			/* Collection that last scanned it */
+} llambda;
+
+/* Lists with at most this many children keep them inside the lval */
+#define LVAL_INLINE 3
+
+/* Declare a lisp val struct to help with error handling. Only the union
+   member matching type is live, which keeps a node at 40 bytes. */
 struct lval {
-  int type;
-  
-  long num;
-  char* err;
-  char* sym;
-  lbuiltin fun;
-  
-  int count;
-  struct lval** cell;
+  unsigned char type;
+  unsigned char flags;		/* LVAL_F_* bits */
+  int refs;			/* Number of owners, the value is shared when above 1 */
+
+  union {
+    long num;			/* LVAL_NUM too large to be immediate */
+    char* err;			/* LVAL_ERR */
+    struct {			/* LVAL_SYM */
+      lsym* sym;
+      struct lenv* env;		/* Global environment the symbol was last found in, or NULL */
+      long version;		/* env->version at the time */
+      struct lenv_entry* slot;	/* The binding it was found in */
+    };
+    struct {			/* LVAL_FUN */
+      lbuiltin* fun;		/* NULL for a lambda */
+      llambda* lambda;
+    };
+    struct lval* next_free;	/* Freed node on a slab free list */
+
+    struct {			/* LVAL_SEXPR and LVAL_QEXPR */
+      int count;
+      int capacity;		/* Slots in cell, 0 while the children are inline, LVAL_VEC for a vector */
+      union {
+	struct lval** cell;	/* Children when capacity > 0 */
+	struct lval* small[LVAL_INLINE]; /* Children when capacity == 0 */
+	struct {		/* Children when capacity == LVAL_VEC */
+	  struct lvec* vec;
+	  int offset;		/* Index in vec of the first child, lists view part of a vector */
+	};
+      };
+    };
+  };
 };
 
-/* Declare our environment that holds 2 name, lval arrays */
+/* Long Q-expressions keep their children in a persistent vector, of
+   which they may see only count elements from offset */
+#define LVAL_VEC (-1)
+#define LVAL_IS_VEC(val) ((val)->capacity == LVAL_VEC)
+
+/* The children of a flat list, wherever they are stored */
+#define LVAL_CELLS(val) ((val)->capacity ? (val)->cell : (val)->small)
+
+/* A single binding in the environment's hash table */
+typedef struct lenv_entry {
+  lsym* sym;			/* Interned symbol (name), NULL marks an empty slot */
+  lval* val;			/* Lisp Value */
+} lenv_entry;
+
+/* Declare our environment as an open addressing (linear probing) hash table */
 struct lenv {
   int count;			/* Number of items in the environment */
-  char** syms;			/* Symbols (name) */
-  lval** vals;			/* Lisp Values */
+  int capacity;			/* Number of slots, always a power of two */
+  lenv_entry* entries;		/* The slots */
+  struct lenv* parent;		/* Searched next, NULL for the global environment */
+  long version;			/* Changes whenever bindings move between slots */
 };
 
 /* Enum of possible lisp val types */
 enum { LVAL_NUM, LVAL_ERR, LVAL_SYM,
-  LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR };
+  LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR, LVAL_TYPES };
+
+/* Small integers are stored in the lval pointer itself, tagged with a
+   set low bit, so they never allocate. Read types and numbers through
+   these macros, anything else is only valid for boxed values. */
+#define LVAL_IS_IMM(val) (((uintptr_t) (val)) & 1)
+#define LVAL_TYPE(val) (LVAL_IS_IMM(val) ? LVAL_NUM : (val)->type)
+#define LVAL_NUMBER(val) (LVAL_IS_IMM(val) ? (long) ((intptr_t) (val) >> 1) : (val)->num)
+#define LVAL_IMM_MIN (-(1L << (sizeof(long) * 8 - 2))) /* Range that survives the shift */
+#define LVAL_IMM_MAX ((1L << (sizeof(long) * 8 - 2)) - 1)
+
+/* lval flags */
+enum {
+  LVAL_F_ARENA = 1,		/* Allocated from the arena, freed by arena_reset */
+  LVAL_F_FREE  = 2,		/* On a slab free list */
+  LVAL_F_MARK  = 4		/* Reached by the current garbage collection */
+};
+
+/* Memory management. lvals come from slabs with a free list per type and
+   cell arrays from power of two size classes. While the arena is active
+   both are bump allocated instead and released all at once. */
+lval* lval_alloc(int type);
+void lval_free(lval* val);
+void lval_resize(lval* val, int count); /* Set the number of children, growing geometrically and shrinking lazily */
+char* lstr_dup(char* str);
+void lstr_free(char* str, lval* owner);
+void arena_begin(void);		/* Allocate from the arena until arena_end */
+void arena_end(void);
+void arena_reset(void);		/* Free everything allocated from the arena */
+
+/* Garbage collection. With --gc, lval_del no longer frees anything and
+   unreachable lvals are swept from the slabs instead. Roots are every
+   environment plus the VM stack and the code of every VM frame. */
+void gc_add_root(lenv* env);
+void gc_remove_root(lenv* env);
+void gc_safepoint(void);	/* Collect if enough has been allocated, only call when every live value is rooted */
+void gc_collect(void);
+void gc_mark(lval* val);	/* Mark val, gc_mark_roots scans its children */
+void gc_mark_code(struct lcode* code); /* Mark the constants of code */
+
+/* Persistent vectors, shared between lists and never modified once built.
+   Functions returning an lvec return a new reference. */
+lvec* lvec_from(lval** items, int count);	/* Vector of count > 0 items, taking their references */
+lvec* lvec_retain(lvec* vec);
+void lvec_release(lvec* vec);
+int lvec_size(lvec* vec);
+lval* lvec_nth(lvec* vec, int i);
+int lvec_flatten(lvec* vec, int from, int to, lval** out);	/* Copy pointers to elements [from, to) to out */
+lvec* lvec_slice(lvec* vec, int from, int to);	/* Elements [from, to), to > from */
+lvec* lvec_concat(lvec* left, lvec* right);
+
+/* Symbol table */
+lsym* lsym_intern(char* name);	/* Find or create the unique lsym for name */
+void lsym_cleanup(void);	/* Free every interned symbol */
 
 /* Constructors */
 lval* lval_num(long x);
 lval* lval_err(char* e);
 lval* lval_sym(char* sym);
-lval* lval_fun(lbuiltin func);
+lval* lval_fun(lbuiltin* builtin);
+lval* lval_lambda(llambda* lambda);	/* Takes the reference to lambda */
 lval* lval_sexpr(void);
 lval* lval_qexpr(void);
-
-/* Lisp Value copy function */
+lval* lval_vec(lvec* vec);	/* Q-expression holding vec, taking the reference */
+
+/* Vector backed lists */
+int lval_use_vec(lval* list);	/* Whether list operations on list should go through a vector */
+void lval_vectorize(lval* list);	/* Move a flat list's children to a vector in place */
+lvec* lval_as_vec(lval* list);	/* New reference to a vector of exactly list's children */
+void lval_unvec(lval* list);	/* Convert a vector list back to a flat one in place */
+lval* lval_nth(lval* list, int i);	/* Child i of any list */
+lval* lval_slice(lval* list, int from, int to);	/* New Q-expression viewing list's children [from, to) */
+
+/* Lisp Value copy functions. Values are shared, so lval_copy only takes
+   another reference; anything that mutates a value must lval_own it first. */
 lval* lval_copy(lval* orig_lval);
+lval* lval_clone(lval* orig_lval);	/* One level copy, children are shared */
+lval* lval_own(lval* val);	/* val itself if unshared, else a clone replacing this reference */
+lval* lval_call(lval* fun, lval** args, int argc, lenv* env); /* Apply a function, consuming it and the arguments */
+lval* lval_call_builtin(lbuiltin* builtin, lval** args, int argc, lenv* env); /* Check the arguments, then call */
+lval* lval_eval_operand(lval* x, lenv* env); /* Evaluate a special form's operand where the caller's variables are visible */
+lval* lval_eval_operands(lval** args, int argc, lenv* env); /* Evaluate a special form's operands, returning the first error */
+int lval_eq(lval* x, lval* y);
+int lval_is_nullary(lval* val);	/* A builtin or a lambda without formals */
+
+/* Lambdas */
+llambda* llambda_retain(llambda* lambda);
+void llambda_release(llambda* lambda);
+int llambda_slot(llambda* scope, lsym* sym);	/* Slot of sym in scope, -1 if it is global */
 
 /* Destructors */
 void lval_del(lval* val);
@@ -86,64 +250,331 @@ void lval_del(lval* val);
 lenv* lenv_new(void);		/* constructor */
 void lenv_del(lenv* env);	/* destructor */
 int lenv_contains(lval* sym, lenv* env);	/* Check if the env contains this name value pairing */
-lval* lenv_get(lval* sym, lenv* env);	/* Get a value from the environment */
-void lval_insert(lval* sym, lenv* env, lval* val);  /* Remove value from the environment */
+lval* lenv_get(lval* sym, lenv* env);	/* Get a value from the environment or its parents */
+void lenv_insert(lval* sym, lenv* env, lval* val);  /* Add or replace a value in the environment */
+void lenv_remove(lval* sym, lenv* env);	/* Remove value from the environment */
 
 
 /* Print a lisp value */
+typedef struct lbuf {		/* Output rendered in memory */
+  char* data;
+  size_t len;
+  size_t capacity;
+  FILE* file;			/* Written to when full, NULL to keep growing */
+} lbuf;
+
+void lbuf_reserve(lbuf* buf, size_t n);	/* Make room for n more bytes */
+void lbuf_flush(lbuf* buf);
+void lbuf_putc(lbuf* buf, char c);
+void lbuf_puts(lbuf* buf, char* s);
+void lbuf_putn(lbuf* buf, long n);	/* Append n in decimal */
+typedef struct lwrite_frame {	/* A list or lambda part way through printing */
+  lval* val;
+  lval** cells;			/* Its elements, flattened if it is a vector */
+  int next;			/* Index of the next element to print */
+} lwrite_frame;
+
+void lval_write(lbuf* buf, lval* val);	/* Append the printed form of val */
+char* lval_to_string(lval* val);	/* The printed form of val, to be freed by the caller */
 void lval_print(lval* val);
 void lval_println(lval* val);
-void lval_expr_print(lval* val, char open, char close);
 
 /* Read functions */
 lval* lval_read_num(mpc_ast_t* tree);
 lval* lval_read(mpc_ast_t* tree);
+mpc_val_t* lval_read_number(mpc_val_t* str);	/* mpc_apply callbacks, consuming the matched text */
+mpc_val_t* lval_read_symbol(mpc_val_t* str);
+mpc_val_t* lval_read_sexpr(int n, mpc_val_t** xs);	/* mpc_many folds */
+mpc_val_t* lval_read_qexpr(int n, mpc_val_t** xs);
+lval* lval_read_input(char* input);	/* Read input by hand, NULL if it does not parse */
+void lval_reader_build(void);	/* Build the grammars from their text */
+int lval_reader_save(char* path);	/* Write a snapshot of the built grammars */
+int lval_reader_load(char* path);
+void lval_reader_init(char* snapshot);
+void lval_reader_cleanup(void);
+int lval_parse(char* name, char* input, mpc_result_t* result); /* Parse input into an sexpr of its forms */
 lval* lval_add(lval* val, lval* new_val);
 
 /* Eval functions */
-lval* builtin(char* func, lval* operands);
-lval* builtin_op(char* sym, lval* sexpr);
-lval* builtin_head(lval* qexpr);
-lval* builtin_tail(lval* qexpr);
-lval* builtin_join(lval* sexpr);
-lval* builtin_len(lval* sexpr);
-lval* builtin_cons(lval* sexpr);
-lval* builtin_init(lval* sexpr);
+void lenv_add_builtins(lenv* env);	/* Bind every builtin in the environment */
+lval* builtin_add(lval** args, int argc, lenv* env);
+lval* builtin_sub(lval** args, int argc, lenv* env);
+lval* builtin_mul(lval** args, int argc, lenv* env);
+lval* builtin_div(lval** args, int argc, lenv* env);
+lval* builtin_mod(lval** args, int argc, lenv* env);
+lval* builtin_list(lval** args, int argc, lenv* env);
+lval* builtin_head(lval** args, int argc, lenv* env);
+lval* builtin_tail(lval** args, int argc, lenv* env);
+lval* builtin_join(lval** args, int argc, lenv* env);
+lval* builtin_eval(lval** args, int argc, lenv* env);
+lval* builtin_len(lval** args, int argc, lenv* env);
+lval* builtin_cons(lval** args, int argc, lenv* env);
+lval* builtin_init(lval** args, int argc, lenv* env);
+lval* builtin_nth(lval** args, int argc, lenv* env);
+lval* builtin_def(lval** args, int argc, lenv* env);
+lval* builtin_lambda(lval** args, int argc, lenv* env);
+lval* builtin_if(lval** args, int argc, lenv* env);
+lval* builtin_and(lval** args, int argc, lenv* env);
+lval* builtin_or(lval** args, int argc, lenv* env);
+lval* builtin_eq(lval** args, int argc, lenv* env);
+lval* builtin_ne(lval** args, int argc, lenv* env);
+lval* builtin_lt(lval** args, int argc, lenv* env);
+lval* builtin_gt(lval** args, int argc, lenv* env);
+lval* builtin_le(lval** args, int argc, lenv* env);
+lval* builtin_ge(lval** args, int argc, lenv* env);
+lval* builtin_mem_stats(lval** args, int argc, lenv* env);
+lval* builtin_gc_stats(lval** args, int argc, lenv* env);
+lval* builtin_lookup_stats(lval** args, int argc, lenv* env);
 lval* lval_take(lval* val, int i);
 lval* lval_pop(lval* sexpr, int i);
 lval* lval_join(lval* first, lval* lval_second);
 lval* lval_eval(lval* val, lenv* env);
-lval* lval_eval_sexpr(lval* sexpr, lenv* env);
+lval* lval_eval_sexpr(lval* sexpr, lenv** env, int* tail); /* One step of lval_eval, see there */
+lenv* lval_bind_tree(lval* fun, lval** args, lenv* env); /* New environment for a lambda call, consuming args */
+lval* lval_body(llambda* lambda);	/* A lambda's body as an S-expression to evaluate */
+lval* lval_if_branch(lval** args, lenv* env); /* The branch if takes as an S-expression, or an error */
+
+/* The tree walker loops on the body of a lambda and the branch of if or
+   eval, recursing only on operands. This bounds that recursion, a level
+   takes around 500 bytes of C stack unoptimised. */
+#define LTREE_MAX_DEPTH 5000
+int tree_depth = 0;
+
+/* The compiler and folder recurse once per level of an s-expression, so
+   they stop at the same depth and compile the error in its place */
+int compile_depth = 0;
+
+/* Bytecode compiler and stack VM */
+enum {
+  OP_CONST,			/* Push constant arg */
+  OP_LOAD,			/* Push the global named by constant arg */
+  OP_HEAD,			/* Push the global heading the S-expression constant arg, then OP_QUOTE */
+  OP_QUOTE,			/* Push the operands of S-expression constant arg as written if the top value is a special form */
+  OP_LOCAL,			/* Push the frame's slot arg */
+  OP_FREE,			/* Push the running lambda's captured value arg */
+  OP_APPLY,			/* Call the top arg values */
+  OP_FOLD,			/* Skip the OP_JUMP that follows unless a name in Q-expression constant arg was rebound */
+  OP_JUMP,			/* Skip arg instructions */
+  OP_BRANCH,			/* Pop a condition, skip arg instructions if it is 0 */
+  OP_EVAL,			/* Pop a Q-expression and evaluate it in place */
+  OP_AND,			/* Pop a number, if it is 0 push 0 and skip arg instructions */
+  OP_OR				/* Pop a number, unless it is 0 push 1 and skip arg instructions */
+};
+
+#define LVM_ARGS 16		/* Builtin calls with up to this many operands pass them on the C stack */
+
+typedef struct linstr {
+  int op;			/* One of the OP_* codes */
+  int arg;			/* Constant, slot or operand count */
+} linstr;
+
+typedef struct lcode {
+  int count;			/* Number of instructions */
+  int capacity;			/* Allocated instruction slots */
+  linstr* instrs;		/* The instructions */
+
+  int const_count;		/* Number of constants */
+  lval** consts;		/* Constants and symbols referenced by the code */
+  struct lcode** subs;		/* Code eval and if compiled from a constant, by index */
+  long epoch;			/* fold.epoch when compiled */
+} lcode;
+
+/* A running piece of code. Lambda calls and eval push frames rather
+   than recursing into lvm_exec, and replace the current one when they
+   are in tail position. */
+typedef struct lframe {
+  lcode* code;
+  int pc;			/* Next instruction */
+  int base;			/* Stack size when the frame started */
+  int owned;			/* Delete code when the frame ends */
+  int locals;			/* Stack index of slot 0 */
+  lval* fun;			/* Lambda whose slots and captures the code sees, or NULL */
+} lframe;
+
+/* Which engine lval_run hands expressions to */
+enum { ENGINE_VM, ENGINE_TREE };
+int engine = ENGINE_VM;
+
+/* Allocate each REPL evaluation's temporaries from the arena. Nothing
+   is freed until the evaluation ends, so a long loop in one input holds
+   all its garbage, and lists stay flat rather than becoming vectors. */
+int use_arena = 0;
+
+/* Reclaim lvals with the tracing collector instead of lval_del */
+int use_gc = 0;
+
+/* How input is turned into lvals. The mpc grammars are the reference,
+   READ_AST goes through the mpca grammar's AST and READ_HAND uses a
+   single pass reader, falling back to mpc to report errors. */
+enum { READ_MPC, READ_AST, READ_HAND };
+int read_mode = READ_MPC;
+
+/* Evaluate calls of pure builtins on constants when compiling, and
+   print how many expressions each line folded */
+int use_fold = 1;
+int fold_stats = 0;
+
+/* Folded code assumes the builtins it called are still bound to the
+   same names. Rebinding one stamps its symbol with a new epoch, and code
+   compiled before that takes the unfolded path where it relied on it. */
+struct {
+  long epoch;
+  long count;			/* S-expressions folded so far */
+  int plain;			/* Compiling a fallback, fold and inline nothing */
+  lval* names;			/* Symbols the expression being folded relies on, NULL when not folding */
+} fold = { 0, 0, 0, NULL };
+
+lcode* lcode_new(void);
+void lcode_del(lcode* code);
+void lcode_emit(lcode* code, int op, int arg);
+int lcode_const(lcode* code, lval* val);
+void lval_compile(lval* val, lcode* code, llambda* scope, lenv* env); /* Compile val into code, consuming val */
+lval* lval_fold(lval* val, llambda* scope, lenv* env, int* nodes); /* The constant val evaluates to, or NULL */
+lval* lval_fold_sexpr(lval* val, llambda* scope, lenv* env, int* nodes);
+lval* lvm_exec(lcode* code, lenv* env);	/* Run code and return the value it leaves */
+int lvm_is_builtin(lval* x, lbuiltin_fn call);	/* Whether x is the builtin call */
+lval* lvm_eval(lval* x, lenv* env);	/* Evaluate x in the running frame, consuming it */
+void lvm_push(lval* val);
+lval* lvm_pop(void);
+lval* lval_run(lval* val, lenv* env);	/* Evaluate val with the selected engine */
+void lval_eval_print(lval* val, lenv* env); /* Evaluate and print one input, consuming it */
+int lval_run_chunk(char* name, char* input, long row, lenv* env); /* Evaluate the forms of part of a script */
+int lval_run_script(char* path, lenv* env); /* Batch mode, returns the exit status */
+
+void lval_eval_print(lval* val, lenv* env) { /* Evaluate and print one input, consuming it */
+  if (use_arena) { arena_begin(); }
+
+  long folded = fold.count;
+  lval* res = lval_run(val, env);
+
+  lval_println(res);
+  if (fold_stats) { printf("folded %ld\n", fold.count - folded); }
+  lval_del(res);
+
+  if (use_arena) { arena_end(); arena_reset(); }
+  gc_safepoint();
+}
+
+int lval_run_chunk(char* name, char* input, long row, lenv* env) { /* Evaluate the forms in input, which starts at row */
+  mpc_result_t result;
+  if (!lval_parse(name, input, &result)) {
+    result.error->state.row += row;
+    mpc_err_print(result.error);
+    mpc_err_delete(result.error);
+    return 0;
+  }
+
+  /* The forms still to run stay on the VM stack where the collector
+     sees them, each is swapped for an immediate as it is taken */
+  lval* forms = result.output;
+  lvm_push(forms);
+  for (int i = 0; i < forms->count; i++) {
+    lval* form = LVAL_CELLS(forms)[i];
+    LVAL_CELLS(forms)[i] = lval_num(0);
+    lval_eval_print(form, env);
+  }
+  lval_del(lvm_pop());
+  return 1;
+}
+
+int lval_run_script(char* path, lenv* env) { /* Evaluate every top level form of a file, "-" is stdin */
+  FILE* file = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+  char* name = file == stdin ? "<stdin>" : path;
+  if (!file) {
+    fprintf(stderr, "Could not open %s\n", path);
+    return 1;
+  }
+
+  /* Results are only read once the job is done, buffer them fully */
+  setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+
+  /* A form may span lines, so lines are gathered until their brackets
+     balance and parsed together. mpc slows down more than linearly
+     with the number of forms it parses in one go, so the whole input
+     is never handed over at once. */
+  size_t size = 0, capacity = 4096;
+  char* input = malloc(capacity);
+  long row = 0, start = 0;	/* Lines read, and the line input starts at */
+  int depth = 0, status = 0;
+
+  while (fgets(input + size, capacity - size, file)) {
+    for (char* c = input + size; *c; c++) {
+      depth += (*c == '(' || *c == '{') - (*c == ')' || *c == '}');
+    }
+    size += strlen(input + size);
+
+    if (input[size-1] != '\n' && size + 1 == capacity) { /* Only part of a long line */
+      input = realloc(input, capacity *= 2);
+      continue;
+    }
+
+    row++;
+    if (depth > 0) { continue; }
+
+    if (!lval_run_chunk(name, input, start, env)) { status = 1; }
+    size = 0;
+    depth = 0;
+    start = row;
+  }
+
+  /* Whatever is left is unbalanced, let the parser report it */
+  if (size && !lval_run_chunk(name, input, start, env)) { status = 1; }
+
+  free(input);
+  if (file != stdin) { fclose(file); }
+  fflush(stdout);
+  return status;
+}
 
 int main(int argc, char** argv){
-  /* Define the grammar for polish notation. */
-  mpc_parser_t* Number = mpc_new("number");
-  mpc_parser_t* Expr = mpc_new("expr");
-  mpc_parser_t* Symbol = mpc_new("symbol");
-  mpc_parser_t* Lispy = mpc_new("lispy");
-  mpc_parser_t* Sexpr = mpc_new("sexpr");
-  mpc_parser_t* Qexpr = mpc_new("qexpr");
+  char* script = NULL;		/* Run this file instead of the REPL */
+  char* grammar = NULL;		/* Load the reader's grammar from this snapshot */
+  char* save_grammar = NULL;	/* Write a snapshot here and exit */
+
+  /* Select the evaluation engine. */
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--", 2) != 0) script = argv[i];
+    if (strcmp(argv[i], "--tree") == 0) engine = ENGINE_TREE;
+    if (strcmp(argv[i], "--vm") == 0) engine = ENGINE_VM;
+    if (strcmp(argv[i], "--arena") == 0) use_arena = 1;
+    if (strcmp(argv[i], "--gc") == 0) use_gc = 1;
+    if (strcmp(argv[i], "--no-fold") == 0) use_fold = 0;
+    if (strcmp(argv[i], "--fold-stats") == 0) fold_stats = 1;
+    if (strcmp(argv[i], "--ast-reader") == 0) read_mode = READ_AST;
+    if (strcmp(argv[i], "--hand-reader") == 0) read_mode = READ_HAND;
+    if (strncmp(argv[i], "--grammar=", 10) == 0) grammar = argv[i] + 10;
+    if (strncmp(argv[i], "--save-grammar=", 15) == 0) save_grammar = argv[i] + 15;
+  }
+  if (use_gc) { use_arena = 0; } /* The collector only scans the slabs */
+
+  lval_reader_init(grammar);
+  if (save_grammar) {
+    int ok = lval_reader_save(save_grammar);
+    if (!ok) { fprintf(stderr, "Could not save grammar snapshot %s\n", save_grammar); }
+    lval_reader_cleanup();
+    return !ok;
+  }
+
+  lenv* env = lenv_new();
+  lenv_add_builtins(env);
+
+  if (script) {
+    int status = lval_run_script(script, env);
+    lenv_del(env);
+    lsym_cleanup();
+    lval_reader_cleanup();
+    return status;
+  }
 
-  mpca_lang(MPCA_LANG_DEFAULT,
-	    "                                                           \
-              number   : /-?[0-9]+/;					\
-              symbol   : /[a-zA-Z0-9+_\\-*\\/\\\\=<>!&]+/;						\
-	      sexpr    : '(' <expr>* ')';				\
-	      qexpr    : '{' <expr>* '}';				\
-              expr     : <number> | <symbol> | <sexpr> | <qexpr>;	\
-              lispy    : /^/ <expr>* /$/;				\
-	    ",
-	    Number, Symbol, Sexpr, Qexpr, Expr, Lispy);
-  
   /* Print Version and exit information. */
   puts("Lispy Version 0.0.1");
-  puts("Press Ctrl+c to exit.");
-  puts("Press Ctrl+d gives a segfault, we are working to fix this.");
+  puts("Press Ctrl+c or Ctrl+d to exit.");
 
-  /* In a never ending loop. */
+  /* Until the end of input. */
   while (1) {
     /* Output the prompt */
     char* input = readline("Lishp> ");
+    if (!input) { putchar('\n'); break; }
 
     /* Add line to history. */
     add_history(input);
@@ -153,12 +584,8 @@ int main(int argc, char** argv){
     /* Parse the user input */
     mpc_result_t result;
 
-    if (mpc_parse("<stdin>", input, Lispy, &result)) {
-      /* Print the AST. */
-      lval* res = lval_eval(lval_read(result.output));
-
-      lval_println(res);
-      lval_del(res);
+    if (lval_parse("<stdin>", input, &result)) {
+      lval_eval_print(result.output, env);
     } else {
       /* Handle the error */
       mpc_err_print(result.error);
@@ -168,146 +595,600 @@ int main(int argc, char** argv){
     free(input);
   }
 
-  mpc_cleanup(6, Number, Symbol, Sexpr, Qexpr, Expr, Lispy);
+  lenv_del(env);
+  lsym_cleanup();
+  lval_reader_cleanup();
   return 0;
 }
 
+/* Memory management */
+#define LSLAB_NODES 256		/* lvals per slab */
+#define LCELLS_CLASSES 7	/* Cell arrays of 1, 2, 4 ... 64 pointers are pooled */
+#define LCELLS_CHUNK 4096	/* Bytes carved into blocks when a size class runs dry */
+#define ARENA_CHUNK 65536	/* Minimum bytes per arena chunk */
+
+typedef struct lslab {
+  struct lslab* next;
+  lval nodes[LSLAB_NODES];
+} lslab;
+
+typedef struct arena_chunk {
+  struct arena_chunk* next;
+  size_t size;			/* Usable bytes in data */
+  size_t used;			/* Bytes handed out */
+  char data[];
+} arena_chunk;
+
+struct {
+  lslab* slabs;			/* Every slab ever allocated */
+  int slab_count;
+  int slab_used;		/* Nodes handed out from the newest slab */
+  lval* free_vals[LVAL_TYPES];	/* Freed lvals, linked through cell */
+  long vals_in_use;
+  long vals_allocated;		/* Boxed lvals ever allocated, slab or arena */
+
+  void* free_cells[LCELLS_CLASSES]; /* Freed cell blocks, linked through their first pointer */
+  long cell_chunks;
+  long cells_in_use;
+  long vec_nodes;		/* Live persistent vector nodes */
+
+  int arena_active;
+  arena_chunk* arena;		/* Current chunk, older chunks follow */
+  long arena_bytes;
+  int arena_lambda_count;	/* Lambdas referenced from the arena, released by arena_reset */
+  int arena_lambda_capacity;
+  llambda** arena_lambdas;
+} mem = { NULL, 0, LSLAB_NODES, { NULL }, 0, 0, { NULL }, 0, 0, 0, 0, NULL, 0, 0, 0, NULL };
+
+#define GC_MIN_THRESHOLD 65536	/* Allocations between collections, at least */
+
+struct {
+  long allocated;		/* lvals allocated since the last collection */
+  long threshold;		/* Collect once allocated reaches this */
+
+  int root_count;
+  lenv** roots;			/* Environments */
+  int depth;			/* Nesting of lvm_exec */
+
+  long collections;
+  long freed;			/* lvals freed by the collector in total */
+  long last_pause;		/* Microseconds */
+  long max_pause;
+  long total_pause;
+} gc = { 0, GC_MIN_THRESHOLD, 0, NULL, 0, 0, 0, 0, 0, 0 };
+
+void* arena_alloc(size_t size) {
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1); /* Keep pointers aligned */
+
+  if (!mem.arena || mem.arena->used + size > mem.arena->size) {
+    size_t chunk_size = size > ARENA_CHUNK ? size : ARENA_CHUNK;
+    arena_chunk* chunk = malloc(sizeof(arena_chunk) + chunk_size);
+    chunk->next = mem.arena;
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    mem.arena = chunk;
+  }
+
+  void* ptr = mem.arena->data + mem.arena->used;
+  mem.arena->used += size;
+  mem.arena_bytes += size;
+  return ptr;
+}
+
+void arena_begin(void) { mem.arena_active = 1; }
+void arena_end(void) { mem.arena_active = 0; }
+
+void arena_hold_lambda(llambda* lambda) { /* Release lambda when the arena is reset */
+  if (mem.arena_lambda_count == mem.arena_lambda_capacity) {
+    mem.arena_lambda_capacity = mem.arena_lambda_capacity ? mem.arena_lambda_capacity * 2 : 16;
+    mem.arena_lambdas = realloc(mem.arena_lambdas, sizeof(llambda*) * mem.arena_lambda_capacity);
+  }
+  mem.arena_lambdas[mem.arena_lambda_count++] = lambda;
+}
+
+void arena_reset(void) {	/* Keep the newest chunk for the next evaluation */
+  /* Lambdas live outside the arena, drop the arena's references to them */
+  while (mem.arena_lambda_count) { llambda_release(mem.arena_lambdas[--mem.arena_lambda_count]); }
+
+  if (!mem.arena) { return; }
+
+  arena_chunk* chunk = mem.arena->next;
+  while (chunk) {
+    arena_chunk* next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+
+  mem.arena->next = NULL;
+  mem.arena->used = 0;
+  mem.arena_bytes = 0;
+}
+
+lval* lval_alloc(int type) {
+  lval* val;
+  mem.vals_allocated++;
+
+  if (mem.arena_active) {
+    val = arena_alloc(sizeof(lval));
+    val->type = type;
+    val->flags = LVAL_F_ARENA;
+    val->refs = 1;
+    return val;
+  }
+
+  if (mem.free_vals[type]) {	/* Reuse a node freed with the same type */
+    val = mem.free_vals[type];
+    mem.free_vals[type] = val->next_free;
+  } else {
+    if (mem.slab_used == LSLAB_NODES) { /* Start a new slab */
+      lslab* slab = malloc(sizeof(lslab));
+      slab->next = mem.slabs;
+      mem.slabs = slab;
+      mem.slab_count++;
+      mem.slab_used = 0;
+    }
+    val = &mem.slabs->nodes[mem.slab_used++];
+  }
+
+  mem.vals_in_use++;
+  gc.allocated++;
+  val->type = type;
+  val->flags = 0;
+  val->refs = 1;
+  return val;
+}
+
+void lval_free(lval* val) {
+  if (val->flags & LVAL_F_ARENA) { return; }
+
+  val->flags = LVAL_F_FREE;
+  val->next_free = mem.free_vals[val->type];
+  mem.free_vals[val->type] = val;
+  mem.vals_in_use--;
+}
+
+int lcells_class(int count) {	/* Size class holding count pointers, -1 if too big to pool */
+  int class = 0;
+  while ((1 << class) < count) { class++; }
+  return class < LCELLS_CLASSES ? class : -1;
+}
+
+lval** lcells_alloc(lval* owner, int count) {
+  int class = lcells_class(count);
+
+  if (owner->flags & LVAL_F_ARENA) { /* Still round up, lval_resize relies on it */
+    return arena_alloc(class < 0 ? sizeof(lval*) * count : sizeof(lval*) << class);
+  }
+
+  if (class < 0) { return malloc(sizeof(lval*) * count); }
+
+  if (!mem.free_cells[class]) { /* Carve a fresh chunk into blocks of this class */
+    size_t block = sizeof(lval*) << class;
+    char* chunk = malloc(LCELLS_CHUNK);
+    for (size_t off = 0; off + block <= LCELLS_CHUNK; off += block) {
+      *(void**) (chunk + off) = mem.free_cells[class];
+      mem.free_cells[class] = chunk + off;
+    }
+    mem.cell_chunks++;
+  }
+
+  void* cells = mem.free_cells[class];
+  mem.free_cells[class] = *(void**) cells;
+  mem.cells_in_use++;
+  return cells;
+}
+
+void lcells_free(lval* owner, lval** cells, int count) {
+  if (owner->flags & LVAL_F_ARENA) { return; }
+
+  int class = lcells_class(count);
+  if (class < 0) { free(cells); return; }
+
+  *(void**) cells = mem.free_cells[class];
+  mem.free_cells[class] = cells;
+  mem.cells_in_use--;
+}
+
+void lval_set_capacity(lval* val, int capacity) { /* Move the children to capacity slots, 0 for inline */
+  lval** old = val->capacity ? val->cell : NULL;
+  int old_capacity = val->capacity;
+  int keep = val->count < (capacity ? capacity : LVAL_INLINE) ? val->count : (capacity ? capacity : LVAL_INLINE);
+
+  if (capacity == 0) {		/* Back inline, old is read before small overwrites cell */
+    lval* cells[LVAL_INLINE];
+    memcpy(cells, old, sizeof(lval*) * keep);
+    lcells_free(val, old, old_capacity);
+    memcpy(val->small, cells, sizeof(lval*) * keep);
+  } else if (!old) {		/* Out of line for the first time */
+    lval** cells = lcells_alloc(val, capacity);
+    memcpy(cells, val->small, sizeof(lval*) * keep);
+    val->cell = cells;
+  } else if (lcells_class(old_capacity) < 0 && lcells_class(capacity) < 0
+	     && !(val->flags & LVAL_F_ARENA)) {
+    val->cell = realloc(old, sizeof(lval*) * capacity);
+  } else {
+    val->cell = lcells_alloc(val, capacity);
+    memcpy(val->cell, old, sizeof(lval*) * keep);
+    lcells_free(val, old, old_capacity);
+  }
+
+  val->capacity = capacity;
+}
+
+void lval_resize(lval* val, int count) {
+  if (LVAL_IS_VEC(val)) { lval_unvec(val); }
+
+  int capacity = val->capacity ? val->capacity : LVAL_INLINE;
+
+  if (count > capacity) {	/* Grow geometrically so appends are amortized O(1) */
+    int new_capacity = val->capacity ? val->capacity : 4;
+    while (new_capacity < count) { new_capacity *= 2; }
+    lval_set_capacity(val, new_capacity);
+  } else if (val->capacity && count <= val->capacity / 4) {
+    /* Shrink only once mostly empty, so alternating add and pop never thrashes */
+    lval_set_capacity(val, count <= LVAL_INLINE ? 0 : val->capacity / 2);
+  }
+
+  val->count = count;
+}
+
+char* lstr_dup(char* str) {
+  char* copy = mem.arena_active ? arena_alloc(strlen(str) + 1) : malloc(strlen(str) + 1);
+  strcpy(copy, str);
+  return copy;
+}
+
+void lstr_free(char* str, lval* owner) {
+  if (!(owner->flags & LVAL_F_ARENA)) { free(str); }
+}
+
+lval* builtin_mem_stats(lval** args, int argc, lenv* env) { /* {slabs n lvals n allocated n cell-chunks n cells n vec-nodes n arena-bytes n} */
+  (void)args; (void)argc; (void)env;
+  lval* stats = lval_qexpr();
+  stats = lval_add(stats, lval_sym("slabs"));
+  stats = lval_add(stats, lval_num(mem.slab_count));
+  stats = lval_add(stats, lval_sym("lvals"));
+  stats = lval_add(stats, lval_num(mem.vals_in_use));
+  stats = lval_add(stats, lval_sym("allocated"));
+  stats = lval_add(stats, lval_num(mem.vals_allocated));
+  stats = lval_add(stats, lval_sym("cell-chunks"));
+  stats = lval_add(stats, lval_num(mem.cell_chunks));
+  stats = lval_add(stats, lval_sym("cells"));
+  stats = lval_add(stats, lval_num(mem.cells_in_use));
+  stats = lval_add(stats, lval_sym("vec-nodes"));
+  stats = lval_add(stats, lval_num(mem.vec_nodes));
+  stats = lval_add(stats, lval_sym("arena-bytes"));
+  stats = lval_add(stats, lval_num(mem.arena_bytes));
+  return stats;
+}
+
 /* Lisp Value constructors */
 lval* lval_num(long num) {
-  lval* val = malloc(sizeof(lval));
-  val->type = LVAL_NUM;
+  if (num >= LVAL_IMM_MIN && num <= LVAL_IMM_MAX) {
+    return (lval*) (((uintptr_t) num << 1) | 1);
+  }
+
+  lval* val = lval_alloc(LVAL_NUM);
   val->num = num;
   return val;
 }
 
 lval* lval_err(char* err) {
-  lval* val = malloc(sizeof(lval));
-  val->type = LVAL_ERR;
-  val->err = malloc(strlen(err) + 1);
-  strcpy(val->err, err);
+  lval* val = lval_alloc(LVAL_ERR);
+  val->err = lstr_dup(err);
   return val;
 }
 
 lval* lval_sym(char* sym) {
-  lval* val = malloc(sizeof(lval));
-  val->type = LVAL_SYM;
-  val->sym = malloc(strlen(sym) + 1);
-  strcpy(val->sym, sym);
+  lval* val = lval_alloc(LVAL_SYM);
+  val->sym = lsym_intern(sym);
+  val->env = NULL;
+  return val;
+}
+
+lval* lval_fun(lbuiltin* builtin) {
+  lval *val = lval_alloc(LVAL_FUN);
+  val->fun = builtin;
+  val->lambda = NULL;
   return val;
 }
 
-lval* lval_fun(lbuiltin func) {
-  lval *val = malloc(sizeof(lval));
-  val->type = LVAL_FUN;
-  val->fun = func;
+lval* lval_lambda(llambda* lambda) {
+  lval* val = lval_alloc(LVAL_FUN);
+  val->fun = NULL;
+  val->lambda = lambda;
+  if (val->flags & LVAL_F_ARENA) { arena_hold_lambda(lambda); }
   return val;
 }
 
 lval* lval_sexpr(void) {
-  lval* val = malloc(sizeof(lval));
-  val->type = LVAL_SEXPR;
+  lval* val = lval_alloc(LVAL_SEXPR);
   val->count = 0;
-  val->cell = NULL;
+  val->capacity = 0;
   return val;
 }
 
 lval* lval_qexpr(void) {
-  lval* val = malloc(sizeof(lval));
-  val->type = LVAL_QEXPR;
+  lval* val = lval_alloc(LVAL_QEXPR);
   val->count = 0;
-  val->cell = NULL;
+  val->capacity = 0;
   return val;  
 }
 
+lval* lval_vec(lvec* vec) {
+  lval* val = lval_alloc(LVAL_QEXPR);
+  val->count = lvec_size(vec);
+  val->capacity = LVAL_VEC;
+  val->vec = vec;
+  val->offset = 0;
+  return val;
+}
+
 /* Lisp Value deletion */
-void lval_del(lval* val) {
+struct {
+  int count;
+  int capacity;
+  lval** vals;
+  int active;			/* An lval_del is emptying the list */
+} lval_dels = { 0, 0, NULL, 0 };	/* Values to free, so deep lists never recurse */
+
+void lval_destroy(lval* val) {	/* Free val, handing its children to lval_del */
   switch (val->type) {
   case LVAL_NUM: break;
-  case LVAL_FUN: break;
-  case LVAL_SYM:
-    free(val->sym);
+  case LVAL_FUN:		/* The arena's lambdas are released by arena_reset */
+    if (val->lambda && !(val->flags & LVAL_F_ARENA)) { llambda_release(val->lambda); }
     break;
+  case LVAL_SYM: break;		/* Symbols are owned by the symbol table */
   case LVAL_ERR:
-    free(val->err);
+    lstr_free(val->err, val);
     break;
   case LVAL_QEXPR:
   case LVAL_SEXPR:
+    if (LVAL_IS_VEC(val)) {	/* The vector owns the children */
+      lvec_release(val->vec);
+      break;
+    }
     for (int i = 0; i < val->count; i++) {
-      lval_del(val->cell[i]);
+      lval_del(LVAL_CELLS(val)[i]);
     }
-    free(val->cell);
+    lval_resize(val, 0);
     break;
   }
   
-  free(val);
+  lval_free(val);
 }
 
-/* Lisp Value printing. */
-void lval_print(lval* val) {
-  switch (val->type) {
-  case LVAL_NUM:
-    printf("%ld", val->num);
-    break;
-  case LVAL_ERR:
-    printf("Error: %s!", val->err);
-    break;
-  case LVAL_SYM:
-    printf("%s", val->sym);
-    break;
-  case LVAL_FUN:
-    printf("<function>");
-    break;
-  case LVAL_SEXPR:
-    lval_expr_print(val, '(', ')');
-    break;
-  case LVAL_QEXPR:
-    lval_expr_print(val, '{', '}');
-    break;
+void lval_del(lval* val) {
+  if (LVAL_IS_IMM(val)) { return; }
+  if (use_gc) { return; }	/* Left to the collector, refs stays as a "may be shared" hint */
+  if (--val->refs > 0) { return; } /* Still shared */
+
+  if (lval_dels.count == lval_dels.capacity) {
+    lval_dels.capacity = lval_dels.capacity ? lval_dels.capacity * 2 : 256;
+    lval_dels.vals = realloc(lval_dels.vals, sizeof(lval*) * lval_dels.capacity);
+  }
+  lval_dels.vals[lval_dels.count++] = val;
+
+  if (lval_dels.active) { return; } /* Freed by the lval_del further up */
+
+  lval_dels.active = 1;
+  while (lval_dels.count) { lval_destroy(lval_dels.vals[--lval_dels.count]); }
+  lval_dels.active = 0;
+}
+
+/* Lisp Value printing. Values are rendered into a buffer, which
+   lval_print writes to stdout in large blocks rather than a stdio call
+   per number and separator. */
+#define LBUF_FLUSH 65536	/* lval_print writes out whenever it holds this much */
+
+lbuf lout = { NULL, 0, 0, NULL };
+
+void lbuf_reserve(lbuf* buf, size_t n) {
+  if (buf->file && buf->len + n > LBUF_FLUSH) { lbuf_flush(buf); }
+  if (buf->len + n <= buf->capacity) { return; }
+
+  while (buf->len + n > buf->capacity) { /* Grow geometrically */
+    buf->capacity = buf->capacity ? buf->capacity * 2 : 256;
   }
+  buf->data = realloc(buf->data, buf->capacity);
+}
+
+void lbuf_flush(lbuf* buf) {
+  if (buf->len) { fwrite(buf->data, 1, buf->len, buf->file); }
+  buf->len = 0;
+}
+
+void lbuf_putc(lbuf* buf, char c) {
+  lbuf_reserve(buf, 1);
+  buf->data[buf->len++] = c;
 }
 
-void lval_println(lval* val) { lval_print(val); putchar('\n'); }
+void lbuf_puts(lbuf* buf, char* s) {
+  size_t n = strlen(s);
+  lbuf_reserve(buf, n);
+  memcpy(buf->data + buf->len, s, n);
+  buf->len += n;
+}
+
+void lbuf_putn(lbuf* buf, long n) {
+  char digits[24];		/* Filled from the end */
+  char* p = digits + sizeof(digits);
+  unsigned long u = n < 0 ? -(unsigned long)n : (unsigned long)n;
+
+  do {
+    *--p = '0' + u % 10;
+    u /= 10;
+  } while (u);
+  if (n < 0) { *--p = '-'; }
+
+  size_t len = digits + sizeof(digits) - p;
+  lbuf_reserve(buf, len);
+  memcpy(buf->data + buf->len, p, len);
+  buf->len += len;
+}
+
+/* Lists are printed with a stack of their own rather than by recursion,
+   as values can nest far deeper than the C stack allows. */
+void lval_write(lbuf* buf, lval* val) {
+  lwrite_frame* frames = NULL;
+  int count = 0, capacity = 0;
+
+  while (val) {
+    switch (LVAL_TYPE(val)) {
+    case LVAL_NUM:
+      lbuf_putn(buf, LVAL_NUMBER(val));
+      break;
+    case LVAL_ERR:
+      lbuf_puts(buf, "Error: ");
+      lbuf_puts(buf, val->err);
+      lbuf_putc(buf, '!');
+      break;
+    case LVAL_SYM:
+      lbuf_puts(buf, val->sym->name);
+      break;
+    case LVAL_FUN:
+      if (!val->lambda) {
+        lbuf_puts(buf, "<function>");
+        break;
+      }
+      lbuf_puts(buf, "(\\ ");
+      break;
+    case LVAL_SEXPR:
+      lbuf_putc(buf, '(');
+      break;
+    case LVAL_QEXPR:
+      lbuf_putc(buf, '{');
+      break;
+    }
 
-void lval_expr_print(lval* val, char open, char close) {
-  putchar(open);
+    if (LVAL_TYPE(val) == LVAL_SEXPR || LVAL_TYPE(val) == LVAL_QEXPR || (LVAL_TYPE(val) == LVAL_FUN && val->lambda)) {
+      if (count == capacity) {	/* Grow geometrically */
+        capacity = capacity ? capacity * 2 : 16;
+        frames = realloc(frames, sizeof(lwrite_frame) * capacity);
+      }
+      lwrite_frame* frame = &frames[count++];
+      frame->val = val;
+      frame->cells = NULL;
+      frame->next = 0;
+
+      if (LVAL_TYPE(val) != LVAL_FUN && LVAL_IS_VEC(val)) {	/* A lambda's formals and body are read from it */
+        frame->cells = malloc(sizeof(lval*) * val->count);
+        lvec_flatten(val->vec, val->offset, val->offset + val->count, frame->cells);
+      } else if (LVAL_TYPE(val) != LVAL_FUN) {
+        frame->cells = LVAL_CELLS(val);
+      }
+    }
 
-  for (int i = 0; i < val->count; i++) { /* Print the value */
-    lval_print(val->cell[i]);
-    
-    if (i != val->count - 1) {	/* Print a space between the values */
-      putchar(' ');
+    /* Move on to the next element, closing every list it finishes */
+    val = NULL;
+    while (count && !val) {
+      lwrite_frame* frame = &frames[count - 1];
+      int lambda = LVAL_TYPE(frame->val) == LVAL_FUN;
+
+      if (frame->next < (lambda ? 2 : frame->val->count)) {
+        if (frame->next) { lbuf_putc(buf, ' '); }	/* Print a space between the values */
+        val = !lambda ? frame->cells[frame->next]
+          : frame->next ? frame->val->lambda->body : frame->val->lambda->formals;
+        frame->next++;
+        continue;
+      }
+
+      lbuf_putc(buf, LVAL_TYPE(frame->val) == LVAL_QEXPR ? '}' : ')');
+      if (!lambda && LVAL_IS_VEC(frame->val)) { free(frame->cells); }
+      count--;
     }
   }
 
-  putchar(close);
+  free(frames);
+}
+
+char* lval_to_string(lval* val) {
+  lbuf buf = { NULL, 0, 0, NULL };
+  lval_write(&buf, val);
+  lbuf_putc(&buf, '\0');
+  return buf.data;
 }
 
-/* Lisp Value copy function */
+void lval_print(lval* val) {
+  lout.file = stdout;
+  lval_write(&lout, val);
+  lbuf_flush(&lout);
+}
+
+void lval_println(lval* val) {
+  lout.file = stdout;
+  lval_write(&lout, val);
+  lbuf_putc(&lout, '\n');
+  lbuf_flush(&lout);
+}
+
+/* Lisp Value copy functions. The arena is reset under anything pointing
+   into it, so arena values are cloned when they escape, that is when
+   they are copied with the arena off. Slab values are shared into the
+   arena like anywhere else. An arena value holds its references to them
+   until it is deleted, so they are never changed in place meanwhile. */
 lval* lval_copy(lval* orig_val) {
-  lval* copy_val = malloc(sizeof(lval));
-  copy_val->type = orig_val->type;
+  if (LVAL_IS_IMM(orig_val)) { return orig_val; }
+
+  if (orig_val->flags & LVAL_F_ARENA && !mem.arena_active) {
+    return lval_clone(orig_val);
+  }
+
+  orig_val->refs++;
+  return orig_val;
+}
+
+lval* lval_own(lval* val) {
+  if (LVAL_IS_IMM(val)) { return val; }
+  if (val->refs == 1 && !(mem.arena_active && !(val->flags & LVAL_F_ARENA))) { return val; }
+
+  lval* copy_val = lval_clone(val);
+  lval_del(val);
+  return copy_val;
+}
+
+lval* lval_clone(lval* orig_val) {
+  if (LVAL_IS_IMM(orig_val)) { return orig_val; }
+
+  lval* copy_val = lval_alloc(orig_val->type);
 
   switch (copy_val->type) {
   case LVAL_NUM:
     copy_val->num = orig_val->num;
     break;
-  case LVAL_FUN:
+  case LVAL_FUN:		/* Lambdas are immutable, share it */
     copy_val->fun = orig_val->fun;
+    copy_val->lambda = orig_val->lambda ? llambda_retain(orig_val->lambda) : NULL;
+    if (copy_val->lambda && copy_val->flags & LVAL_F_ARENA) { arena_hold_lambda(copy_val->lambda); }
     break;
   case LVAL_ERR:
-    copy_val->err = malloc(sizeof(strlen(orig_val->err)+1));
-    strcpy(copy_val->err, orig_val->err);
+    copy_val->err = lstr_dup(orig_val->err);
     break;
-  case LVAL_SYM:
-    copy_val->sym = malloc(sizeof(strlen(orig_val->sym)+1));
-    strcpy(copy_val->sym, orig_val->sym);
+  case LVAL_SYM:		/* Interned, so copying the pointer is enough */
+    copy_val->sym = orig_val->sym;
+    copy_val->env = NULL;
     break;
   case LVAL_QEXPR:
   case LVAL_SEXPR:
-    copy_val->count = orig_val->count;
-    copy_val->cell = malloc(sizeof(lval*) * orig_val->count);
+    if (LVAL_IS_VEC(orig_val) && !mem.arena_active) { /* Vectors are immutable, share it */
+      copy_val->count = orig_val->count;
+      copy_val->capacity = LVAL_VEC;
+      copy_val->vec = lvec_retain(orig_val->vec);
+      copy_val->offset = orig_val->offset;
+      break;
+    }
+
+    copy_val->count = 0;
+    copy_val->capacity = 0;
+    lval_resize(copy_val, orig_val->count);
+    if (LVAL_IS_VEC(orig_val)) {
+      lvec_flatten(orig_val->vec, orig_val->offset, orig_val->offset + orig_val->count,
+		   LVAL_CELLS(copy_val));
+    } else {
+      memcpy(LVAL_CELLS(copy_val), LVAL_CELLS(orig_val), sizeof(lval*) * orig_val->count);
+    }
     for (int i = 0; i < orig_val->count; i++) {
-      copy_val->cell[i] = lval_copy(orig_val->cell[i]);
+      LVAL_CELLS(copy_val)[i] = lval_copy(LVAL_CELLS(copy_val)[i]);
     }
     break;
   }
@@ -315,339 +1196,2472 @@ lval* lval_copy(lval* orig_val) {
   return copy_val;
 }
 
-/* Environment Manipulation */
-lenv* lenv_new(void) {
-  lenv* env = malloc(sizeof(lenv));
-  env->count = 0;
-  env->syms = NULL;
-  env->vals = NULL;
+/* Persistent vectors: relaxed radix balanced trees. Every leaf is at the
+   same depth and each node keeps the cumulative sizes of its children,
+   so nodes need not be full. Slicing and concatenating copy only the
+   nodes along the cut and share the rest. */
+#define LVEC_BITS 5
+#define LVEC_WIDTH (1 << LVEC_BITS)	/* Children per node, elements per leaf */
+#define LVEC_MIN 64		/* tail, init and join move lists this long to a vector */
+
+struct lvec {
+  int refs;
+  int height;			/* 0 for a leaf */
+  int count;			/* Elements in a leaf, children in a node */
+  long marked;			/* Collection that last scanned it */
+  int sizes[LVEC_WIDTH];	/* Nodes only, elements under kids[0..i] */
+  union {
+    lval* items[LVEC_WIDTH];	/* Leaves */
+    struct lvec* kids[LVEC_WIDTH]; /* Nodes */
+  };
+};
 
-  return env;
+lvec* lvec_new(int height) {
+  lvec* vec = malloc(sizeof(lvec));
+  vec->refs = 1;
+  vec->height = height;
+  vec->count = 0;
+  vec->marked = 0;
+  mem.vec_nodes++;
+  return vec;
 }
 
-void lenv_del(lenv* env) {
-  for (int i = 0; i < env->count; i++) { /* Free array indices */
-    free(env->syms[i]);
-    free(env->vals[i]);
-  }
-  /* Free the array pointers */
-  free(env->syms);
-  free(env->vals);
-
-  free(env);			/* Free the entire struct. */
+lvec* lvec_retain(lvec* vec) {
+  vec->refs++;
+  return vec;
 }
 
-int lenv_contains(lval* sym, lenv* env) {
-  for (int i = 0; i < env->count; i++) {
-    if (strcmp(sym->sym, env->syms[i]) == 0) {
-      return i;
-    }
+void lvec_release(lvec* vec) {
+  if (--vec->refs > 0) { return; }
+
+  for (int i = 0; i < vec->count; i++) {
+    if (vec->height) { lvec_release(vec->kids[i]); } else { lval_del(vec->items[i]); }
   }
 
-  return -1;			/* Symbol not in the environment */
+  mem.vec_nodes--;
+  free(vec);
 }
 
-lval* lenv_get(lval* sym, lenv* env) {
-  int idx = lenv_contains(sym, env);
+int lvec_size(lvec* vec) {
+  return vec->height ? vec->sizes[vec->count-1] : vec->count;
+}
 
-  if (idx >= 0) {		/* Create a copy and return it */
-    return lval_copy(env->vals[idx]);
+void lvec_fix_sizes(lvec* node) { /* Rebuild the size table after changing the children */
+  int size = 0;
+  for (int i = 0; i < node->count; i++) {
+    size += lvec_size(node->kids[i]);
+    node->sizes[i] = size;
   }
-  
-  /* Symbol not found, return an error.  */
-  return lval_err("Symbol not found");
 }
 
-void lenv_insert(lval* sym, lenv* env, lval* val) {
-  int idx = lenv_contains(sym, env);
-
-  if (idx >= 0) {		/* Reassign the value */
-    lval_del(env->vals[idx]);
-    env->vals[idx] = lval_copy(val);
-    return;
-  }
+lvec* lvec_pair(lvec* left, lvec* right) { /* Node one level up over both, taking their references */
+  lvec* node = lvec_new(left->height + 1);
+  node->kids[0] = left;
+  node->kids[1] = right;
+  node->count = 2;
+  lvec_fix_sizes(node);
+  return node;
+}
 
-  env->count++;
-  env->syms = realloc(env->syms, env->count);
-  env->vals = realloc(env->vals, env->count);
+lvec* lvec_copy_node(lvec* vec) { /* One level copy holding its own references */
+  lvec* copy = lvec_new(vec->height);
+  copy->count = vec->count;
 
-  env->syms[env->count-1] = malloc(sizeof(strlen(sym->sym)+1));
-  strcpy(env->syms[env->count-1], sym->sym);
-  env->vals[env->count-1] = lval_copy(val);
-}
+  for (int i = 0; i < vec->count; i++) {
+    if (vec->height) {
+      copy->kids[i] = lvec_retain(vec->kids[i]);
+      copy->sizes[i] = vec->sizes[i];
+    } else {
+      copy->items[i] = lval_copy(vec->items[i]);
+    }
+  }
 
-lval* lval_read_num(mpc_ast_t* tree) {
-  errno = 0;
-  long num = strtol(tree->contents, NULL, 10);
-  return errno != ERANGE ?
-    lval_num(num) : lval_err("invalid number!");
+  return copy;
 }
 
-lval* lval_read(mpc_ast_t* tree) {
-  /* If it's a symbol/number return the symbol/number  */
-  if (strstr(tree->tag, "number")) return lval_read_num(tree);
-  if (strstr(tree->tag, "symbol")) return lval_sym(tree->contents);
+int lvec_child(lvec* node, int* i) { /* Child holding element *i, which becomes the index within it */
+  /* Children hold at most WIDTH^height elements, so the radix guess
+     is exact for full nodes and a lower bound otherwise */
+  int shift = LVEC_BITS * node->height;
+  int child = shift < 31 ? *i >> shift : 0;
 
-  /* If at the root or start of a new sexpr, create a new sexpr */
-  lval* sexpr = NULL;
+  while (node->sizes[child] <= *i) { child++; }
+  if (child) { *i -= node->sizes[child-1]; }
+  return child;
+}
 
-  if (strcmp(tree->tag, ">") == 0) { sexpr = lval_sexpr(); } /* The root expression is an sexpr. */
-  if (strstr(tree->tag, "sexpr")) { sexpr = lval_sexpr(); }  /* Any embedded sexpr */
-  if (strstr(tree->tag, "qexpr")) { sexpr = lval_qexpr(); }
+lvec* lvec_from(lval** items, int count) {
+  int n = (count + LVEC_WIDTH - 1) / LVEC_WIDTH;
+  lvec** level = malloc(sizeof(lvec*) * n);
 
-  /* Add all valid expressions contained within the parentheses. */
-  for (int i = 0; i < tree->children_num; i++) {
-    if (strcmp(tree->children[i]->contents, "(") == 0) continue; /* Skip the first parantheses. */
-    if (strcmp(tree->children[i]->contents, ")") == 0) continue; /* Skip the last parantheses. */
-    if (strcmp(tree->children[i]->tag, "regex") == 0) continue;
-    if (strcmp(tree->children[i]->contents, "{") == 0) continue;
-    if (strcmp(tree->children[i]->contents, "}") == 0) continue;
+  for (int i = 0; i < n; i++) {	/* Full leaves, the last one takes the rest */
+    level[i] = lvec_new(0);
+    level[i]->count = count - i * LVEC_WIDTH < LVEC_WIDTH ? count - i * LVEC_WIDTH : LVEC_WIDTH;
+    memcpy(level[i]->items, &items[i * LVEC_WIDTH], sizeof(lval*) * level[i]->count);
+  }
 
-    sexpr = lval_add(sexpr, lval_read(tree->children[i]));
+  for (int height = 1; n > 1; height++) { /* Then full nodes over them up to a single root */
+    int m = (n + LVEC_WIDTH - 1) / LVEC_WIDTH;
+    for (int i = 0; i < m; i++) {
+      lvec* node = lvec_new(height);
+      node->count = n - i * LVEC_WIDTH < LVEC_WIDTH ? n - i * LVEC_WIDTH : LVEC_WIDTH;
+      memcpy(node->kids, &level[i * LVEC_WIDTH], sizeof(lvec*) * node->count);
+      lvec_fix_sizes(node);
+      level[i] = node;
+    }
+    n = m;
   }
 
-  return sexpr;
+  lvec* root = level[0];
+  free(level);
+  return root;
 }
 
-lval* lval_add(lval* orig_lval, lval* new_lval) {
-  orig_lval->count++;
-  orig_lval->cell = realloc(orig_lval->cell, sizeof(lval*) * orig_lval->count);
-  orig_lval->cell[orig_lval->count - 1] = new_lval;
-  return orig_lval;
+lval* lvec_nth(lvec* vec, int i) {
+  while (vec->height) { vec = vec->kids[lvec_child(vec, &i)]; }
+  return vec->items[i];
 }
 
-lval* lval_eval_sexpr(lval* sexpr, lenv* env) {
-  /* Evaluate the children */
-  for (int i = 0; i < sexpr->count; i++) {
-    sexpr->cell[i] = lval_eval(sexpr->cell[i], env);
+int lvec_flatten(lvec* vec, int from, int to, lval** out) {
+  if (!vec->height) {
+    memcpy(out, &vec->items[from], sizeof(lval*) * (to - from));
+    return to - from;
   }
 
-  /* In case of an error return it */
-  for (int i = 0; i < sexpr->count; i++) {
-    if (sexpr->cell[i]->type == LVAL_ERR) {
-      return lval_take(sexpr, i);
-    }
-  }
+  int first = from, last = to - 1;
+  int i = lvec_child(vec, &first);
+  int j = lvec_child(vec, &last);
 
-  /* In case of an empty sexpr return it */
-  if (sexpr->count == 0) {
-    return sexpr;
+  int n = 0;
+  for (int k = i; k <= j; k++) {
+    int lo = k == i ? first : 0;
+    int hi = k == j ? last + 1 : lvec_size(vec->kids[k]);
+    n += lvec_flatten(vec->kids[k], lo, hi, out + n);
   }
+  return n;
+}
 
-  /* In case of a single element sexpr return the single element */
-  if (sexpr->count == 1) {
-    return lval_take(sexpr, 0);
-  }
+lvec* lvec_slice_node(lvec* vec, int from, int to) { /* Like lvec_slice but keeps the height */
+  if (from == 0 && to == lvec_size(vec)) { return lvec_retain(vec); }
 
-  /* Ensure the first element is a function */
-  lval* first = lval_pop(sexpr, 0);
-  if (first->type != LVAL_FUN) {
-    lval_del(first);
-    lval_del(sexpr);
-    return lval_err("S-Expression does not start with symbol");
+  if (!vec->height) {
+    lvec* leaf = lvec_new(0);
+    for (int i = from; i < to; i++) { leaf->items[leaf->count++] = lval_copy(vec->items[i]); }
+    return leaf;
   }
-  
-  /* apply a builtin to the reduced sexpr */
-  lval* result = first->fun(sexpr, env);
-  lval_del(first);
-  return result;
-}
 
-lval* lval_eval(lval* sexpr, lenv* env) {
-  if (sexpr->type == LVAL_SYM) {
-    lval* val = lenv_get(sexpr, env);
-    lval_del(sexpr);
-    return val;
+  int first = from, last = to - 1;
+  int i = lvec_child(vec, &first);
+  int j = lvec_child(vec, &last);
+
+  lvec* node = lvec_new(vec->height);
+  for (int k = i; k <= j; k++) { /* Only the children at either end are cut */
+    int lo = k == i ? first : 0;
+    int hi = k == j ? last + 1 : lvec_size(vec->kids[k]);
+    node->kids[node->count++] = lvec_slice_node(vec->kids[k], lo, hi);
   }
-  if (sexpr->type == LVAL_SEXPR) /* reduce s-expressions then return them */
-    return lval_eval_sexpr(sexpr, env);
 
-  return sexpr;			/* Return all other types as they're in simplest form */
+  lvec_fix_sizes(node);
+  return node;
 }
 
-lval* lval_pop(lval* sexpr, int i) { /* Get the element at i and remove it from the sexpr */
-  lval* elem = sexpr->cell[i];
+lvec* lvec_slice(lvec* vec, int from, int to) {
+  lvec* root = lvec_slice_node(vec, from, to);
 
-  memmove(&sexpr->cell[i], &sexpr->cell[i+1],  /* Move memory over the top */
-	  sizeof(lval*) * (sexpr->count-i-1));
+  while (root->height && root->count == 1) { /* Drop roots with a single child */
+    lvec* kid = lvec_retain(root->kids[0]);
+    lvec_release(root);
+    root = kid;
+  }
 
-  sexpr->count--;		/* Decrease count of items */
-  sexpr->cell = realloc(sexpr->cell, sizeof(lval*) * sexpr->count); /* Realloc the memory used */
-  return elem;			/* Return the element popped */
+  return root;
 }
 
-lval* lval_take(lval* sexpr, int i) {		/* Like lval_pop but deletes the list from which it was taken */
-  lval* elem = lval_pop(sexpr, i);
-  lval_del(sexpr);
-  return elem;
+lvec* lvec_merge_leaves(lvec* left, lvec* right) { /* One leaf holding both, they must fit */
+  lvec* leaf = lvec_copy_node(left);
+  for (int i = 0; i < right->count; i++) { leaf->items[leaf->count++] = lval_copy(right->items[i]); }
+  return leaf;
+}
+
+/* Add sub, which is lower than node, along node's right edge. Returns the
+   new node and sets *spill to a new right sibling if node was full. */
+lvec* lvec_join_right(lvec* node, lvec* sub, lvec** spill) {
+  lvec* copy = lvec_copy_node(node);
+  lvec* last = copy->kids[copy->count-1];
+  lvec* extra = NULL;
+  *spill = NULL;
+
+  if (node->height > sub->height + 1) {
+    copy->kids[copy->count-1] = lvec_join_right(last, sub, &extra);
+    lvec_release(last);
+  } else if (!sub->height && last->count + sub->count <= LVEC_WIDTH) {
+    copy->kids[copy->count-1] = lvec_merge_leaves(last, sub); /* Keep leaves dense at the seam */
+    lvec_release(last);
+  } else {
+    extra = lvec_retain(sub);
+  }
+
+  if (extra && copy->count < LVEC_WIDTH) {
+    copy->kids[copy->count++] = extra;
+  } else if (extra) {
+    *spill = lvec_new(node->height);
+    (*spill)->kids[(*spill)->count++] = extra;
+    lvec_fix_sizes(*spill);
+  }
+
+  lvec_fix_sizes(copy);
+  return copy;
+}
+
+/* The mirror image of lvec_join_right, *spill becomes a left sibling */
+lvec* lvec_join_left(lvec* sub, lvec* node, lvec** spill) {
+  lvec* copy = lvec_copy_node(node);
+  lvec* first = copy->kids[0];
+  lvec* extra = NULL;
+  *spill = NULL;
+
+  if (node->height > sub->height + 1) {
+    copy->kids[0] = lvec_join_left(sub, first, &extra);
+    lvec_release(first);
+  } else if (!sub->height && sub->count + first->count <= LVEC_WIDTH) {
+    copy->kids[0] = lvec_merge_leaves(sub, first);
+    lvec_release(first);
+  } else {
+    extra = lvec_retain(sub);
+  }
+
+  if (extra && copy->count < LVEC_WIDTH) {
+    memmove(&copy->kids[1], &copy->kids[0], sizeof(lvec*) * copy->count);
+    copy->kids[0] = extra;
+    copy->count++;
+  } else if (extra) {
+    *spill = lvec_new(node->height);
+    (*spill)->kids[(*spill)->count++] = extra;
+    lvec_fix_sizes(*spill);
+  }
+
+  lvec_fix_sizes(copy);
+  return copy;
+}
+
+lvec* lvec_concat(lvec* left, lvec* right) {
+  lvec* spill;
+
+  if (left->height > right->height) {
+    lvec* root = lvec_join_right(left, right, &spill);
+    return spill ? lvec_pair(root, spill) : root;
+  }
+
+  if (left->height < right->height) {
+    lvec* root = lvec_join_left(left, right, &spill);
+    return spill ? lvec_pair(spill, root) : root;
+  }
+
+  if (left->count + right->count > LVEC_WIDTH) {
+    return lvec_pair(lvec_retain(left), lvec_retain(right));
+  }
+
+  if (!left->height) { return lvec_merge_leaves(left, right); }
+
+  lvec* root = lvec_copy_node(left); /* Both roots fit in one node */
+  for (int i = 0; i < right->count; i++) { root->kids[root->count++] = lvec_retain(right->kids[i]); }
+  lvec_fix_sizes(root);
+  return root;
+}
+
+/* Vector backed lists. The arena never holds vectors: their nodes are
+   reference counted and arena values are never deleted one by one. */
+int lval_use_vec(lval* list) {
+  if (mem.arena_active || list->flags & LVAL_F_ARENA) { return 0; }
+  return LVAL_IS_VEC(list) || list->count >= LVEC_MIN;
+}
+
+void lval_vectorize(lval* list) { /* Changes only the representation, so fine on shared lists */
+  if (LVAL_IS_VEC(list)) { return; }
+
+  int count = list->count;
+  lvec* vec = lvec_from(LVAL_CELLS(list), count);
+  lval_resize(list, 0);		/* The vector has the children now */
+  list->count = count;
+  list->capacity = LVAL_VEC;
+  list->vec = vec;
+  list->offset = 0;
+}
+
+lvec* lval_as_vec(lval* list) {
+  lval_vectorize(list);
+
+  if (list->offset == 0 && list->count == lvec_size(list->vec)) {
+    return lvec_retain(list->vec);
+  }
+  return lvec_slice(list->vec, list->offset, list->offset + list->count);
+}
+
+void lval_unvec(lval* list) {
+  lvec* vec = list->vec;
+  int count = list->count;
+
+  /* The list is outside the arena, keep its children there too */
+  int arena = mem.arena_active;
+  arena_end();
+
+  int offset = list->offset;
+  list->count = 0;
+  list->capacity = 0;
+  lval_resize(list, count);
+  lvec_flatten(vec, offset, offset + count, LVAL_CELLS(list));
+  for (int i = 0; i < count; i++) {
+    LVAL_CELLS(list)[i] = lval_copy(LVAL_CELLS(list)[i]);
+  }
+  lvec_release(vec);
+
+  if (arena) { arena_begin(); }
+}
+
+lval* lval_nth(lval* list, int i) {
+  return LVAL_IS_VEC(list) ? lvec_nth(list->vec, list->offset + i) : LVAL_CELLS(list)[i];
+}
+
+lval* lval_slice(lval* list, int from, int to) {
+  if (from == to) { return lval_qexpr(); }
+  lval_vectorize(list);
+
+  /* Once a view sees less than half of its vector, cut the vector down
+     so views never keep more than twice their elements alive. Halving
+     each time keeps the O(log n) cuts rare. */
+  if ((to - from) * 2 < lvec_size(list->vec)) {
+    return lval_vec(lvec_slice(list->vec, list->offset + from, list->offset + to));
+  }
+
+  lval* view = lval_alloc(LVAL_QEXPR);
+  view->count = to - from;
+  view->capacity = LVAL_VEC;
+  view->vec = lvec_retain(list->vec);
+  view->offset = list->offset + from;
+  return view;
+}
+
+/* Symbol table, another linear probing hash table keyed by name */
+#define LSYM_MIN_CAPACITY 256	/* Initial number of slots, must be a power of two */
+
+struct {
+  int count;			/* Number of interned symbols */
+  int capacity;			/* Number of slots, always a power of two */
+  lsym** syms;			/* The slots, NULL marks an empty slot */
+} symtab = { 0, 0, NULL };
+
+unsigned long lsym_hash(char* name) { /* FNV-1a, never returns 0 */
+  unsigned long hash = 2166136261UL;
+
+  while (*name) {
+    hash ^= (unsigned char) *name++;
+    hash *= 16777619UL;
+  }
+
+  return hash ? hash : 1;
+}
+
+int lsym_find_slot(char* name, unsigned long hash) { /* Slot holding name or the empty slot it belongs in */
+  int mask = symtab.capacity - 1;
+  int i = hash & mask;
+
+  while (symtab.syms[i]) {
+    if (symtab.syms[i]->hash == hash && strcmp(symtab.syms[i]->name, name) == 0) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+
+  return i;
+}
+
+void lsym_grow(void) {		/* Double the slot array and rehash every symbol */
+  lsym** old = symtab.syms;
+  int old_capacity = symtab.capacity;
+
+  symtab.capacity = old_capacity ? old_capacity * 2 : LSYM_MIN_CAPACITY;
+  symtab.syms = calloc(symtab.capacity, sizeof(lsym*));
+
+  for (int i = 0; i < old_capacity; i++) {
+    if (old[i]) {
+      symtab.syms[lsym_find_slot(old[i]->name, old[i]->hash)] = old[i];
+    }
+  }
+
+  free(old);
+}
+
+lsym* lsym_intern(char* name) {
+  if ((symtab.count + 1) * 4 > symtab.capacity * 3) { lsym_grow(); }
+
+  unsigned long hash = lsym_hash(name);
+  int idx = lsym_find_slot(name, hash);
+
+  if (symtab.syms[idx]) {	/* Already interned */
+    return symtab.syms[idx];
+  }
+
+  lsym* sym = malloc(sizeof(lsym) + strlen(name) + 1);
+  sym->hash = hash;
+  sym->rebound = 0;
+  strcpy(sym->name, name);
+
+  symtab.count++;
+  symtab.syms[idx] = sym;
+  return sym;
+}
+
+void lsym_cleanup(void) {
+  for (int i = 0; i < symtab.capacity; i++) {
+    free(symtab.syms[i]);
+  }
+  free(symtab.syms);
+
+  symtab.count = 0;
+  symtab.capacity = 0;
+  symtab.syms = NULL;
+}
+
+/* Environment Manipulation */
+#define LENV_MIN_CAPACITY 16	/* Initial number of slots, must be a power of two */
+
+/* Symbols cache the slot of their global binding along with the
+   environment's version. Versions come from one clock so an environment
+   allocated where a freed one was never matches a stale cache. */
+long lenv_clock = 0;
+
+struct {
+  long hits;
+  long misses;
+} lookups = { 0, 0 };
+
+lenv* lenv_new(void) {
+  lenv* env = malloc(sizeof(lenv));
+  env->count = 0;
+  env->capacity = LENV_MIN_CAPACITY;
+  env->entries = calloc(env->capacity, sizeof(lenv_entry));
+  env->parent = NULL;
+  env->version = ++lenv_clock;
+
+  gc_add_root(env);
+  return env;
+}
+
+void lenv_del(lenv* env) {
+  for (int i = 0; i < env->capacity; i++) { /* Free occupied slots */
+    if (env->entries[i].sym) {
+      lval_del(env->entries[i].val);
+    }
+  }
+  /* Free the slot array */
+  free(env->entries);
+  gc_remove_root(env);
+
+  free(env);			/* Free the entire struct. */
+}
+
+int lenv_find_slot(lenv* env, lsym* sym) { /* Slot holding sym or the empty slot it belongs in */
+  int mask = env->capacity - 1;
+  int i = sym->hash & mask;
+
+  while (env->entries[i].sym) {
+    if (env->entries[i].sym == sym) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+
+  return i;
+}
+
+void lenv_grow(lenv* env) {	/* Double the slot array and rehash every entry */
+  lenv_entry* old = env->entries;
+  int old_capacity = env->capacity;
+
+  env->capacity *= 2;
+  env->entries = calloc(env->capacity, sizeof(lenv_entry));
+  env->version = ++lenv_clock;	/* Every binding moves */
+
+  for (int i = 0; i < old_capacity; i++) {
+    if (old[i].sym) {
+      env->entries[lenv_find_slot(env, old[i].sym)] = old[i];
+    }
+  }
+
+  free(old);
+}
+
+int lenv_contains(lval* sym, lenv* env) {
+  int i = lenv_find_slot(env, sym->sym);
+
+  if (env->entries[i].sym) {
+    return i;
+  }
+
+  return -1;			/* Symbol not in the environment */
+}
+
+lval* builtin_lookup_stats(lval** args, int argc, lenv* env) { /* {hits n misses n}, global lookups served by the symbol's cache or not */
+  (void)args; (void)argc; (void)env;
+  lval* stats = lval_qexpr();
+  stats = lval_add(stats, lval_sym("hits"));
+  stats = lval_add(stats, lval_num(lookups.hits));
+  stats = lval_add(stats, lval_sym("misses"));
+  stats = lval_add(stats, lval_num(lookups.misses));
+  return stats;
+}
+
+lval* lenv_get(lval* sym, lenv* env) {
+  for (; env->parent; env = env->parent) { /* Per call environments of the tree walker */
+    int idx = lenv_contains(sym, env);
+
+    if (idx >= 0) {		/* Create a copy and return it */
+      return lval_copy(env->entries[idx].val);
+    }
+  }
+
+  /* Adding or reassigning a binding leaves the others where they are,
+     so the cached slot holds until the version changes */
+  if (sym->env == env && sym->version == env->version) {
+    lookups.hits++;
+    return lval_copy(sym->slot->val);
+  }
+
+  lookups.misses++;
+  int idx = lenv_contains(sym, env);
+  if (idx < 0) {		/* Symbol not found, return an error. */
+    return lval_err("Symbol not found");
+  }
+
+  sym->env = env;
+  sym->version = env->version;
+  sym->slot = &env->entries[idx];
+  return lval_copy(sym->slot->val);
+}
+
+void lenv_insert(lval* sym, lenv* env, lval* val) {
+  int idx = lenv_find_slot(env, sym->sym);
+
+  /* Bindings outlive the evaluation, so never copy them into the arena */
+  int arena = mem.arena_active;
+  arena_end();
+
+  if (env->entries[idx].sym) {	/* Reassign the value */
+    lval* old = env->entries[idx].val;
+    if (LVAL_TYPE(old) == LVAL_FUN && old->fun) { sym->sym->rebound = ++fold.epoch; }
+    lval_del(old);
+    env->entries[idx].val = lval_copy(val);
+    if (arena) { arena_begin(); }
+    return;
+  }
+
+  /* Keep the load factor at or below 3/4 so probe sequences stay short */
+  if ((env->count + 1) * 4 > env->capacity * 3) {
+    lenv_grow(env);
+    idx = lenv_find_slot(env, sym->sym);
+  }
+
+  env->count++;
+  env->entries[idx].sym = sym->sym;
+  env->entries[idx].val = lval_copy(val);
+  if (arena) { arena_begin(); }
+}
+
+void lenv_remove(lval* sym, lenv* env) {
+  int idx = lenv_contains(sym, env);
+  if (idx < 0) { return; }
+
+  lval_del(env->entries[idx].val);
+  env->count--;
+  env->version = ++lenv_clock;	/* Bindings after it may shift */
+
+  /* Backward shift deletion: pull later members of the probe run into the
+     hole so lookups never need tombstones. */
+  int mask = env->capacity - 1;
+  int hole = idx;
+  int i = (idx + 1) & mask;
+
+  while (env->entries[i].sym) {
+    int home = env->entries[i].sym->hash & mask;
+
+    /* Move the entry if its home slot is not cyclically within (hole, i] */
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      env->entries[hole] = env->entries[i];
+      hole = i;
+    }
+    i = (i + 1) & mask;
+  }
+
+  env->entries[hole].sym = NULL;
+  env->entries[hole].val = NULL;
+}
+
+lval* lval_read_num(mpc_ast_t* tree) {
+  errno = 0;
+  long num = strtol(tree->contents, NULL, 10);
+  return errno != ERANGE ?
+    lval_num(num) : lval_err("invalid number!");
+}
+
+lval* lval_read(mpc_ast_t* tree) {
+  /* If it's a symbol/number return the symbol/number  */
+  if (strstr(tree->tag, "number")) return lval_read_num(tree);
+  if (strstr(tree->tag, "symbol")) return lval_sym(tree->contents);
+
+  /* If at the root or start of a new sexpr, create a new sexpr */
+  lval* sexpr = NULL;
+
+  if (strcmp(tree->tag, ">") == 0) { sexpr = lval_sexpr(); } /* The root expression is an sexpr. */
+  if (strstr(tree->tag, "sexpr")) { sexpr = lval_sexpr(); }  /* Any embedded sexpr */
+  if (strstr(tree->tag, "qexpr")) { sexpr = lval_qexpr(); }
+
+  /* Add all valid expressions contained within the parentheses. */
+  for (int i = 0; i < tree->children_num; i++) {
+    if (strcmp(tree->children[i]->contents, "(") == 0) continue; /* Skip the first parantheses. */
+    if (strcmp(tree->children[i]->contents, ")") == 0) continue; /* Skip the last parantheses. */
+    if (strcmp(tree->children[i]->tag, "regex") == 0) continue;
+    if (strcmp(tree->children[i]->contents, "{") == 0) continue;
+    if (strcmp(tree->children[i]->contents, "}") == 0) continue;
+
+    sexpr = lval_add(sexpr, lval_read(tree->children[i]));
+  }
+
+  return sexpr;
+}
+
+/* Reading lvals straight from the parser. The mpca grammar builds an
+   mpc_ast_t, with tag and contents strings for every node, which
+   lval_read then classifies with string compares. The same grammar
+   written with combinators folds each match into an lval instead. */
+struct {
+  mpc_parser_t* number;		/* The mpca grammar */
+  mpc_parser_t* symbol;
+  mpc_parser_t* sexpr;
+  mpc_parser_t* qexpr;
+  mpc_parser_t* expr;
+  mpc_parser_t* lispy;
+
+  mpc_parser_t* form;		/* The combinator grammar, recursive through form */
+  mpc_parser_t* input;
+
+  char* snapshot;		/* Saved grammar the parsers were loaded from, their tags point into it */
+} reader;
+
+mpc_val_t* lval_read_number(mpc_val_t* str) {
+  errno = 0;
+  long num = strtol(str, NULL, 10);
+  free(str);
+  return errno != ERANGE ?
+    lval_num(num) : lval_err("invalid number!");
+}
+
+mpc_val_t* lval_read_symbol(mpc_val_t* str) {
+  lval* sym = lval_sym(str);
+  free(str);
+  return sym;
+}
+
+mpc_val_t* lval_read_sexpr(int n, mpc_val_t** xs) {
+  lval* sexpr = lval_sexpr();
+  lval_resize(sexpr, n);
+  memcpy(LVAL_CELLS(sexpr), xs, sizeof(lval*) * n);
+  return sexpr;
+}
+
+mpc_val_t* lval_read_qexpr(int n, mpc_val_t** xs) {
+  lval* qexpr = lval_read_sexpr(n, xs);
+  qexpr->type = LVAL_QEXPR;
+  return qexpr;
+}
+
+/* Character classes for the hand written reader */
+#define LCHAR_DIGIT 1
+#define LCHAR_SYMBOL 2		/* May appear in a symbol, digits included */
+#define LCHAR_BLANK 4
+
+unsigned char lchar_class[256];
+
+/* The mpc grammar in one pass over the input: blanks after every token,
+   numbers before symbols, and a form ends at the first character
+   that cannot continue it. Open lists are kept on a stack. */
+lval* lval_read_input(char* input) {
+  unsigned char* p = (unsigned char*) input;
+  int depth = 0, capacity = 16;
+  lval** open = malloc(sizeof(lval*) * capacity);
+  open[0] = lval_sexpr();
+
+  char name[64];		/* Symbols are copied out to be NUL terminated */
+  char* sym = name;
+  size_t sym_capacity = sizeof(name);
+
+  while (lchar_class[*p] & LCHAR_BLANK) { p++; }
+
+  while (*p) {
+    lval* x = NULL;
+    unsigned char* start = p;
+
+    if (*p == '(' || *p == '{') {
+      if (++depth == capacity) { open = realloc(open, sizeof(lval*) * (capacity *= 2)); }
+      open[depth] = *p++ == '(' ? lval_sexpr() : lval_qexpr();
+    } else if (*p == ')' || *p == '}') {
+      if (!depth || LVAL_TYPE(open[depth]) != (*p == ')' ? LVAL_SEXPR : LVAL_QEXPR)) { break; }
+      x = open[depth--];
+      p++;
+    } else if (lchar_class[*p] & LCHAR_DIGIT
+	       || (*p == '-' && lchar_class[p[1]] & LCHAR_DIGIT)) {
+      /* Like strtol, accumulate negatively so LONG_MIN fits */
+      int neg = *p == '-';
+      long num = 0, overflow = 0;
+      for (p += neg; lchar_class[*p] & LCHAR_DIGIT; p++) {
+	int d = *p - '0';
+	if (overflow || num < (LONG_MIN + d) / 10) { overflow = 1; continue; }
+	num = num * 10 - d;
+      }
+      if (!neg && num == LONG_MIN) { overflow = 1; }
+      x = overflow ? lval_err("invalid number!") : lval_num(neg ? num : -num);
+    } else if (lchar_class[*p] & LCHAR_SYMBOL) {
+      while (lchar_class[*p] & LCHAR_SYMBOL) { p++; }
+
+      size_t len = p - start;
+      if (len >= sym_capacity) {
+	while (len >= sym_capacity) { sym_capacity *= 2; }
+	sym = sym == name ? malloc(sym_capacity) : realloc(sym, sym_capacity);
+      }
+      memcpy(sym, start, len);
+      sym[len] = '\0';
+      x = lval_sym(sym);
+    } else {
+      break;
+    }
+
+    if (x) { lval_add(open[depth], x); }
+    while (lchar_class[*p] & LCHAR_BLANK) { p++; }
+  }
+
+  if (sym != name) { free(sym); }
+
+  /* Leave reporting errors to mpc */
+  lval* forms = *p || depth ? NULL : open[0];
+  if (!forms) {
+    for (int i = depth; i >= 0; i--) { lval_del(open[i]); }
+  }
+  free(open);
+  return forms;
+}
+
+void lval_reader_build(void) {
+  /* Define the grammar for polish notation. */
+  reader.number = mpc_new("number");
+  reader.expr = mpc_new("expr");
+  reader.symbol = mpc_new("symbol");
+  reader.lispy = mpc_new("lispy");
+  reader.sexpr = mpc_new("sexpr");
+  reader.qexpr = mpc_new("qexpr");
+
+  mpca_lang(MPCA_LANG_DEFAULT,
+	    "                                                           \
+              number   : /-?[0-9]+/;					\
+              symbol   : /[a-zA-Z0-9+_\\-*\\/\\\\=<>!&%]+/;						\
+	      sexpr    : '(' <expr>* ')';				\
+	      qexpr    : '{' <expr>* '}';				\
+              expr     : <number> | <symbol> | <sexpr> | <qexpr>;	\
+              lispy    : /^/ <expr>* /$/;				\
+	    ",
+	    reader.number, reader.symbol, reader.sexpr, reader.qexpr, reader.expr, reader.lispy);
+
+  /* The same rules, in the same order */
+  reader.form = mpc_new("expr");
+  mpc_define(reader.form, mpc_or(4,
+    mpc_apply(mpc_tok(mpc_re("-?[0-9]+")), lval_read_number),
+    mpc_apply(mpc_tok(mpc_re("[a-zA-Z0-9+_\\-*\\/\\\\=<>!&%]+")), lval_read_symbol),
+    mpc_and(3, mpcf_snd_free, mpc_tok(mpc_char('(')), mpc_many(lval_read_sexpr, reader.form),
+	    mpc_tok(mpc_char(')')), free, (mpc_dtor_t) lval_del),
+    mpc_and(3, mpcf_snd_free, mpc_tok(mpc_char('{')), mpc_many(lval_read_qexpr, reader.form),
+	    mpc_tok(mpc_char('}')), free, (mpc_dtor_t) lval_del)));
+  reader.input = mpc_and(3, mpcf_snd_free, mpc_tok(mpc_re("^")), mpc_many(lval_read_sexpr, reader.form),
+			 mpc_tok(mpc_re("$")), free, (mpc_dtor_t) lval_del);
+}
+
+/* Building the grammar parses its text and every regex in it, with a
+   meta-grammar built for each. A snapshot of the built parsers loads
+   without any of that. It refers to the reader's callbacks by their
+   index here, and only loads into the same build. */
+#define LREADER_PARSERS 8
+
+mpc_fn_t lval_reader_fns[] = {
+  (mpc_fn_t) lval_read_number, (mpc_fn_t) lval_read_symbol, (mpc_fn_t) lval_read_sexpr,
+  (mpc_fn_t) lval_read_qexpr, (mpc_fn_t) lval_del
+};
+
+int lval_reader_save(char* path) {
+  mpc_parser_t* parsers[LREADER_PARSERS] = {
+    reader.number, reader.symbol, reader.sexpr, reader.qexpr, reader.expr, reader.lispy,
+    reader.form, reader.input
+  };
+
+  char* blob;
+  size_t len;
+  if (!mpc_save(LREADER_PARSERS, parsers, sizeof(lval_reader_fns) / sizeof(mpc_fn_t), lval_reader_fns,
+		&blob, &len)) {
+    return 0;
+  }
+
+  FILE* file = fopen(path, "wb");
+  int ok = file && fwrite(blob, 1, len, file) == len;
+  if (file && fclose(file) != 0) { ok = 0; }
+  free(blob);
+  return ok;
+}
+
+int lval_reader_load(char* path) {
+  FILE* file = fopen(path, "rb");
+  if (!file) { return 0; }
+
+  size_t len = 0, capacity = 4096;
+  char* blob = malloc(capacity);
+  for (size_t n; (n = fread(blob + len, 1, capacity - len, file)) > 0;) {
+    len += n;
+    if (len == capacity) { blob = realloc(blob, capacity *= 2); }
+  }
+  fclose(file);
+
+  mpc_parser_t* parsers[LREADER_PARSERS];
+  if (!mpc_load(blob, len, LREADER_PARSERS, parsers, sizeof(lval_reader_fns) / sizeof(mpc_fn_t),
+		lval_reader_fns)) {
+    free(blob);
+    return 0;
+  }
+
+  reader.number = parsers[0];
+  reader.symbol = parsers[1];
+  reader.sexpr = parsers[2];
+  reader.qexpr = parsers[3];
+  reader.expr = parsers[4];
+  reader.lispy = parsers[5];
+  reader.form = parsers[6];
+  reader.input = parsers[7];
+  reader.snapshot = blob;
+  return 1;
+}
+
+void lval_reader_init(char* snapshot) { /* Load the grammar from snapshot if it is given, else build it */
+  for (int c = '0'; c <= '9'; c++) { lchar_class[c] |= LCHAR_DIGIT; }
+  for (char* c = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789+_-*/\\=<>!&%"; *c; c++) {
+    lchar_class[(unsigned char) *c] |= LCHAR_SYMBOL;
+  }
+  for (char* c = " \f\n\r\t\v"; *c; c++) { lchar_class[(unsigned char) *c] |= LCHAR_BLANK; }
+
+  reader.snapshot = NULL;
+  if (snapshot && lval_reader_load(snapshot)) { return; }
+
+  if (snapshot) { fprintf(stderr, "Could not load grammar snapshot %s, building it\n", snapshot); }
+  lval_reader_build();
+}
+
+void lval_reader_cleanup(void) {
+  mpc_cleanup(6, reader.number, reader.symbol, reader.sexpr, reader.qexpr, reader.expr, reader.lispy);
+  mpc_delete(reader.input);
+  mpc_cleanup(1, reader.form);
+  mpc_re_cleanup();
+  free(reader.snapshot);
+}
+
+int lval_parse(char* name, char* input, mpc_result_t* result) {
+  if (read_mode == READ_HAND && (result->output = lval_read_input(input))) { return 1; }
+  if (read_mode != READ_AST) { return mpc_parse(name, input, reader.input, result); }
+
+  if (!mpc_parse(name, input, reader.lispy, result)) { return 0; }
+  mpc_ast_t* ast = result->output;
+  result->output = lval_read(ast);
+  mpc_ast_delete(ast);
+  return 1;
+}
+
+lval* lval_add(lval* orig_lval, lval* new_lval) {
+  lval_resize(orig_lval, orig_lval->count + 1);
+  LVAL_CELLS(orig_lval)[orig_lval->count - 1] = new_lval;
+  return orig_lval;
+}
+
+lval* lval_eval_sexpr(lval* sexpr, lenv** env, int* tail) {
+  *tail = 0;
+
+  /* In case of an empty sexpr return it */
+  if (sexpr->count == 0) {
+    return sexpr;
+  }
+
+  /* Evaluate the children, stopping at the first error. Special forms
+     get the operands after the head as written. */
+  lval** cells = LVAL_CELLS(sexpr);
+  for (int i = 0; i < sexpr->count; i++) {
+    cells[i] = lval_eval(cells[i], *env);
+    if (LVAL_TYPE(cells[i]) == LVAL_ERR) { return lval_take(sexpr, i); }
+
+    if (i == 0 && LVAL_TYPE(cells[0]) == LVAL_FUN && cells[0]->fun
+	&& cells[0]->fun->flags & LB_SPECIAL) {
+      break;
+    }
+  }
+
+  /* In case of a single element sexpr return the single element,
+     unless it is a function to call without operands */
+  if (sexpr->count == 1 && !lval_is_nullary(LVAL_CELLS(sexpr)[0])) {
+    return lval_take(sexpr, 0);
+  }
+
+  /* Ensure the first element is a function */
+  lval* fun = LVAL_CELLS(sexpr)[0];
+  if (LVAL_TYPE(fun) != LVAL_FUN) {
+    lval_del(sexpr);
+    return lval_err("S-Expression does not start with symbol");
+  }
+
+  /* The operands are passed where they are, the call consumes them.
+     What lambdas, if and eval go on to evaluate is handed back instead. */
+  lval** args = &LVAL_CELLS(sexpr)[1];
+  int argc = sexpr->count - 1;
+  lval* result;
+
+  if (fun->lambda && argc == fun->lambda->params) {
+    *env = lval_bind_tree(fun, args, *env);
+    result = lval_body(fun->lambda);
+    lval_del(fun);
+    *tail = 1;
+  } else if (lvm_is_builtin(fun, builtin_if) && argc == 3) {
+    result = lval_if_branch(args, *env);
+    for (int i = 0; i < argc; i++) {
+      if (args[i]) { lval_del(args[i]); }
+    }
+    lval_del(fun);
+    *tail = LVAL_TYPE(result) != LVAL_ERR;
+  } else if (lvm_is_builtin(fun, builtin_eval) && argc == 1 && LVAL_TYPE(args[0]) == LVAL_QEXPR) {
+    result = lval_own(args[0]);
+    if (LVAL_IS_VEC(result)) { lval_unvec(result); }
+    result->type = LVAL_SEXPR;
+    lval_del(fun);
+    *tail = 1;
+  } else {
+    result = lval_call(fun, args, argc, *env);
+  }
+
+  lval_resize(sexpr, 0);
+  lval_free(sexpr);
+  return result;
+}
+
+/* Evaluate val. Calls in tail position are evaluated in place, in the
+   environment of the lambda call they are in, which is freed once the
+   next call replaces it. So tail calls run in constant C stack. */
+lval* lval_eval(lval* val, lenv* env) {
+  if (LVAL_TYPE(val) == LVAL_SYM) {
+    lval* x = lenv_get(val, env);
+    lval_del(val);
+    return x;
+  }
+  if (LVAL_TYPE(val) != LVAL_SEXPR) {
+    return val;			/* Return all other types as they're in simplest form */
+  }
+
+  if (tree_depth == LTREE_MAX_DEPTH) {
+    lval_del(val);
+    return lval_err("Expression nested too deeply");
+  }
+  tree_depth++;
+
+  lenv* frame = NULL;		/* The environment of the call running in place, owned here */
+  int tail = 1;
+  while (tail && LVAL_TYPE(val) == LVAL_SEXPR) { /* reduce s-expressions then return them */
+    /* The outermost loop holds nothing but val, every environment is
+       a root, so long running loops collect here like the VM does */
+    if (tree_depth == 1) { lvm_push(val); gc_safepoint(); val = lvm_pop(); }
+
+    lenv* next = env;
+    val = lval_eval_sexpr(lval_own(val), &next, &tail);
+    if (next == env) { continue; }
+
+    if (frame) { lenv_del(frame); }
+    frame = env = next;
+  }
+
+  if (frame) { lenv_del(frame); }
+  tree_depth--;
+  return val;
+}
+
+/* Bytecode */
+lcode* lcode_new(void) {
+  lcode* code = malloc(sizeof(lcode));
+  code->count = 0;
+  code->capacity = 0;
+  code->instrs = NULL;
+  code->const_count = 0;
+  code->consts = NULL;
+  code->subs = NULL;
+  code->epoch = fold.epoch;
+  return code;
+}
+
+void lcode_del(lcode* code) {
+  for (int i = 0; i < code->const_count; i++) {
+    lval_del(code->consts[i]);
+    if (code->subs[i]) { lcode_del(code->subs[i]); }
+  }
+  free(code->consts);
+  free(code->subs);
+  free(code->instrs);
+  free(code);
+}
+
+void lcode_emit(lcode* code, int op, int arg) {
+  if (code->count == code->capacity) { /* Grow geometrically */
+    code->capacity = code->capacity ? code->capacity * 2 : 8;
+    code->instrs = realloc(code->instrs, sizeof(linstr) * code->capacity);
+  }
+
+  code->instrs[code->count].op = op;
+  code->instrs[code->count].arg = arg;
+  code->count++;
+}
+
+int lcode_const(lcode* code, lval* val) { /* Add val to the constant pool and return its index */
+  code->const_count++;
+  code->consts = realloc(code->consts, sizeof(lval*) * code->const_count);
+  code->consts[code->const_count-1] = val;
+  code->subs = realloc(code->subs, sizeof(lcode*) * code->const_count);
+  code->subs[code->const_count-1] = NULL;
+  return code->const_count-1;
+}
+
+/* Constant folding */
+lbuiltin* lval_fold_builtin(lval* head, llambda* scope, lenv* env) { /* The builtin head names, NULL if it is anything else */
+  if (LVAL_TYPE(head) != LVAL_SYM) { return NULL; }
+  if (scope && llambda_slot(scope, head->sym) >= 0) { return NULL; }
+
+  while (env->parent) { env = env->parent; } /* Compiled code only loads globals */
+  int idx = lenv_contains(head, env);
+  if (idx < 0) { return NULL; }
+
+  lval* fun = env->entries[idx].val;
+  if (LVAL_TYPE(fun) != LVAL_FUN || !fun->fun) { return NULL; }
+
+  if (fold.names) {		/* Whatever is compiled from this relies on the binding */
+    for (int i = 0; i < fold.names->count; i++) {
+      if (LVAL_CELLS(fold.names)[i]->sym == head->sym) { return fun->fun; }
+    }
+    lval_add(fold.names, lval_copy(head));
+  }
+  return fun->fun;
+}
+
+int lnum_add_overflows(long a, long b) { return b > 0 ? a > LONG_MAX - b : a < LONG_MIN - b; }
+int lnum_sub_overflows(long a, long b) { return b < 0 ? a > LONG_MAX + b : a < LONG_MIN + b; }
+
+int lnum_mul_overflows(long a, long b) {
+  if (a == 0 || b == 0) { return 0; }
+  if (a > 0) { return b > 0 ? a > LONG_MAX / b : b < LONG_MIN / a; }
+  return b > 0 ? a < LONG_MIN / b : a < LONG_MAX / b;
+}
+
+int lval_fold_overflows(lbuiltin* builtin, lval** args, int argc) { /* Whether +, - or * on args would leave the range of long */
+  int add = builtin->call == builtin_add, sub = builtin->call == builtin_sub;
+  if (!add && !sub && builtin->call != builtin_mul) { return 0; }
+  for (int i = 0; i < argc; i++) {
+    if (LVAL_TYPE(args[i]) != LVAL_NUM) { return 0; } /* The builtin reports it */
+  }
+
+  long acc = add ? 0 : sub ? LVAL_NUMBER(args[0]) : 1;
+  if (sub && argc == 1) { return acc == LONG_MIN; }
+  for (int i = sub; i < argc; i++) {
+    long x = LVAL_NUMBER(args[i]);
+    if (add ? lnum_add_overflows(acc, x) : sub ? lnum_sub_overflows(acc, x) : lnum_mul_overflows(acc, x)) { return 1; }
+    acc = add ? acc + x : sub ? acc - x : acc * x;
+  }
+  return 0;
+}
+
+lval* lval_fold(lval* val, llambda* scope, lenv* env, int* nodes) {
+  switch (LVAL_TYPE(val)) {
+  case LVAL_NUM:
+  case LVAL_QEXPR:
+    return lval_copy(val);
+  case LVAL_SEXPR:
+    if (!val->count || compile_depth == LTREE_MAX_DEPTH) { return NULL; }
+    break;
+  default:
+    return NULL;
+  }
+
+  compile_depth++;
+  lval* result = lval_fold_sexpr(val, scope, env, nodes);
+  compile_depth--;
+  return result;
+}
+
+lval* lval_fold_sexpr(lval* val, llambda* scope, lenv* env, int* nodes) { /* lval_fold on a non-empty s-expression */
+
+  lval* head = LVAL_CELLS(val)[0];
+  if (val->count == 1 && LVAL_TYPE(head) != LVAL_SYM) { /* (x) is x */
+    lval* x = lval_fold(head, scope, env, nodes);
+    if (x) { (*nodes)++; }
+    return x;
+  }
+
+  lbuiltin* builtin = lval_fold_builtin(head, scope, env);
+  int argc = val->count - 1;
+  if (!builtin || !(builtin->flags & LB_PURE) || argc > LVM_ARGS) { return NULL; }
+
+  lval* args[LVM_ARGS];
+  for (int i = 0; i < argc; i++) {
+    args[i] = lval_fold(LVAL_CELLS(val)[i+1], scope, env, nodes);
+    if (args[i]) { continue; }
+
+    while (i--) { lval_del(args[i]); }
+    return NULL;
+  }
+
+  /* Errors and overflows are left to happen when the code runs */
+  if (lval_fold_overflows(builtin, args, argc)) {
+    for (int i = 0; i < argc; i++) { lval_del(args[i]); }
+    return NULL;
+  }
+  lval* result = lval_call_builtin(builtin, args, argc, env);
+  if (LVAL_TYPE(result) == LVAL_ERR) {
+    lval_del(result);
+    return NULL;
+  }
+
+  (*nodes)++;
+  return result;
+}
+
+lval* lval_fold_if(lval* val, llambda* scope, lenv* env, int* nodes) { /* The branch an if on a constant takes, as an sexpr */
+  if (val->count != 4 || LVAL_TYPE(LVAL_CELLS(val)[2]) != LVAL_QEXPR
+      || LVAL_TYPE(LVAL_CELLS(val)[3]) != LVAL_QEXPR) {
+    return NULL;
+  }
+
+  lbuiltin* builtin = lval_fold_builtin(LVAL_CELLS(val)[0], scope, env);
+  if (!builtin || builtin->call != builtin_if) { return NULL; }
+
+  lval* cond = lval_fold(LVAL_CELLS(val)[1], scope, env, nodes);
+  if (!cond) { return NULL; }
+
+  lval* branch = NULL;
+  if (LVAL_TYPE(cond) == LVAL_NUM) {
+    branch = lval_own(lval_copy(LVAL_CELLS(val)[LVAL_NUMBER(cond) ? 2 : 3]));
+    if (LVAL_IS_VEC(branch)) { lval_unvec(branch); }
+    branch->type = LVAL_SEXPR;
+    (*nodes)++;
+  }
+
+  lval_del(cond);
+  return branch;
+}
+
+/* Code that assumes what some names are bound to is guarded by OP_FOLD
+   on the list of those names. While none of them is rebound it skips
+   the first OP_JUMP, else that jumps to the call as written:
+     [FOLD names] [JUMP a] assuming... [JUMP b] fallback... */
+int lval_compile_guard(lcode* code, lval* names) { /* Emit the guard on names, returning the index of its jump */
+  lcode_emit(code, OP_FOLD, lcode_const(code, names));
+  lcode_emit(code, OP_JUMP, 0);
+  return code->count - 1;
+}
+
+int lcode_stale(lcode* code, lval* names) { /* Whether any of names was rebound since code was compiled */
+  if (code->epoch == fold.epoch) { return 0; }
+  for (int i = 0; i < names->count; i++) {
+    if (LVAL_CELLS(names)[i]->sym->rebound > code->epoch) { return 1; }
+  }
+  return 0;
+}
+
+void lval_compile_fallback(lval* val, lcode* code, llambda* scope, lenv* env, int guard) { /* Emit the jump and val as written, consuming it */
+  int jump = code->count;
+  lcode_emit(code, OP_JUMP, 0);
+  code->instrs[guard].arg = code->count - guard - 1;
+
+  fold.plain++;			/* Doing it all again would only repeat the work */
+  lval_compile(val, code, scope, env);
+  fold.plain--;
+
+  code->instrs[jump].arg = code->count - jump - 1;
+}
+
+int lval_compile_folded(lval* val, lcode* code, llambda* scope, lenv* env) { /* Compile val folded if it can be, consuming it */
+  int nodes = 0;
+  fold.names = lval_qexpr();
+  lval* folded = lval_fold(val, scope, env, &nodes);
+  lval* branch = folded ? NULL : lval_fold_if(val, scope, env, &nodes);
+  lval* names = fold.names;
+  fold.names = NULL;
+  if (!folded && !branch) {
+    lval_del(names);
+    return 0;
+  }
+
+  fold.count += nodes;
+
+  int guard = lval_compile_guard(code, names);
+  if (folded) {
+    lcode_emit(code, OP_CONST, lcode_const(code, folded));
+  } else {
+    lval_compile(branch, code, scope, env);
+  }
+  lval_compile_fallback(val, code, scope, env, guard);
+  return 1;
+}
+
+void lval_compile_branch(lval* x, lcode* code, llambda* scope, lenv* env) { /* Compile evaluating if's branch x */
+  if (LVAL_TYPE(x) != LVAL_QEXPR) { /* Whatever it evaluates to is evaluated in turn */
+    lval_compile(lval_copy(x), code, scope, env);
+    lcode_emit(code, OP_EVAL, 0);
+    return;
+  }
+
+  x = lval_own(lval_copy(x));
+  if (LVAL_IS_VEC(x)) { lval_unvec(x); }
+  x->type = LVAL_SEXPR;
+  lval_compile(x, code, scope, env);
+}
+
+int lval_compile_special(lval* val, lcode* code, llambda* scope, lenv* env) { /* Compile if, and and or inline, consuming val */
+  if (!val->count) { return 0; }
+
+  fold.names = lval_qexpr();
+  lbuiltin* builtin = lval_fold_builtin(LVAL_CELLS(val)[0], scope, env);
+  lval* names = fold.names;
+  fold.names = NULL;
+
+  int is_if = builtin && builtin->call == builtin_if && val->count == 4;
+  int op = !builtin ? -1 : builtin->call == builtin_and ? OP_AND : builtin->call == builtin_or ? OP_OR : -1;
+  if (!is_if && (op < 0 || val->count - 1 > LVM_ARGS)) {
+    lval_del(names);
+    return 0;
+  }
+
+  int guard = lval_compile_guard(code, names);
+  if (is_if) {			/* cond [BRANCH a] then [JUMP b] else */
+    lval_compile(lval_copy(LVAL_CELLS(val)[1]), code, scope, env);
+    int branch = code->count;
+    lcode_emit(code, OP_BRANCH, 0);
+    lval_compile_branch(LVAL_CELLS(val)[2], code, scope, env);
+
+    int jump = code->count;
+    lcode_emit(code, OP_JUMP, 0);
+    code->instrs[branch].arg = code->count - branch - 1;
+    lval_compile_branch(LVAL_CELLS(val)[3], code, scope, env);
+    code->instrs[jump].arg = code->count - jump - 1;
+  } else {			/* x [AND end] y [AND end] ... [CONST 1] */
+    int exits[LVM_ARGS];
+    for (int i = 1; i < val->count; i++) {
+      lval_compile(lval_copy(LVAL_CELLS(val)[i]), code, scope, env);
+      exits[i-1] = code->count;
+      lcode_emit(code, op, 0);
+    }
+    lcode_emit(code, OP_CONST, lcode_const(code, lval_num(op == OP_AND)));
+
+    for (int i = 0; i < val->count - 1; i++) {
+      code->instrs[exits[i]].arg = code->count - exits[i] - 1;
+    }
+  }
+  lval_compile_fallback(val, code, scope, env, guard);
+  return 1;
+}
+
+/* Special forms take their operands as written, and whether the head
+   is one is only known once it is evaluated. So the head goes first and
+   the operands are skipped when it is special:
+     head [QUOTE form] [JUMP a] operands... [APPLY n]
+   A global head is loaded by OP_HEAD, which checks it as it goes. */
+void lval_compile_call(lval* val, lcode* code, llambda* scope, lenv* env) { /* Compile the call val, consuming it */
+  if (val->count == 0) {	/* () has no head, it evaluates to itself */
+    lcode_emit(code, OP_APPLY, 0);
+    lval_del(val);
+    return;
+  }
+
+  int form = val->count > 1 ? lcode_const(code, lval_copy(val)) : -1;
+
+  val = lval_own(val);		/* The children are taken over below */
+  lval* head = LVAL_CELLS(val)[0];
+  int jump = -1;
+
+  if (form < 0) {
+    lval_compile(head, code, scope, env);
+  } else if (LVAL_TYPE(head) == LVAL_SYM && !(scope && llambda_slot(scope, head->sym) >= 0)) {
+    lcode_emit(code, OP_HEAD, form);
+    lval_del(head);
+  } else {
+    lval_compile(head, code, scope, env);
+    lcode_emit(code, OP_QUOTE, form);
+  }
+
+  if (form >= 0) {
+    jump = code->count;
+    lcode_emit(code, OP_JUMP, 0);
+  }
+  for (int i = 1; i < val->count; i++) {
+    lval_compile(LVAL_CELLS(val)[i], code, scope, env);
+  }
+  if (jump >= 0) { code->instrs[jump].arg = code->count - jump - 1; }
+  lcode_emit(code, OP_APPLY, val->count);
+
+  /* The children now belong to the code, free the empty shell */
+  lval_resize(val, 0);
+  lval_free(val);
+}
+
+void lval_compile_sexpr(lval* val, lcode* code, llambda* scope, lenv* env) { /* Push every child, then apply */
+  if (!fold.plain && use_fold && lval_compile_folded(val, code, scope, env)) { return; }
+  if (!fold.plain && lval_compile_special(val, code, scope, env)) { return; }
+  lval_compile_call(val, code, scope, env);
+}
+
+void lval_compile(lval* val, lcode* code, llambda* scope, lenv* env) {
+  int slot;
+
+  switch (LVAL_TYPE(val)) {
+  case LVAL_SYM:		/* Read a slot, or look a global up when run */
+    slot = scope ? llambda_slot(scope, val->sym) : -1;
+    if (slot < 0) {
+      lcode_emit(code, OP_LOAD, lcode_const(code, val));
+      break;
+    }
+
+    if (slot < scope->params) {
+      lcode_emit(code, OP_LOCAL, slot);
+    } else {
+      lcode_emit(code, OP_FREE, slot - scope->params);
+    }
+    lval_del(val);
+    break;
+  case LVAL_SEXPR:
+    if (compile_depth == LTREE_MAX_DEPTH) {
+      lcode_emit(code, OP_CONST, lcode_const(code, lval_err("Expression nested too deeply")));
+      lval_del(val);
+      break;
+    }
+
+    compile_depth++;
+    lval_compile_sexpr(val, code, scope, env);
+    compile_depth--;
+    break;
+  default:			/* Everything else evaluates to itself */
+    lcode_emit(code, OP_CONST, lcode_const(code, val));
+    break;
+  }
+}
+
+/* The VM's value and frame stacks, shared by nested runs */
+struct {
+  int sp;			/* Number of values on the stack */
+  int capacity;			/* Allocated stack slots */
+  lval** stack;			/* The values */
+
+  int fp;			/* Number of frames */
+  int frame_capacity;
+  lframe* frames;
+} vm = { 0, 0, NULL, 0, 0, NULL };
+
+void lvm_push(lval* val) {
+  if (vm.sp == vm.capacity) {	/* Grow geometrically */
+    vm.capacity = vm.capacity ? vm.capacity * 2 : 64;
+    vm.stack = realloc(vm.stack, sizeof(lval*) * vm.capacity);
+  }
+  vm.stack[vm.sp++] = val;
+}
+
+lval* lvm_pop(void) { return vm.stack[--vm.sp]; }
+
+lval* lvm_apply(int n, lenv* env) { /* Reduce the top n values like lval_eval_sexpr */
+  lval** args = &vm.stack[vm.sp - n];
+
+  /* Errors never get this far, see lvm_check */
+
+  /* In case of an empty sexpr return it */
+  if (n == 0) {
+    return lval_sexpr();
+  }
+
+  /* In case of a single element sexpr return the single element,
+     unless it is a function to call without operands */
+  if (n == 1 && !lval_is_nullary(args[0])) {
+    return vm.stack[--vm.sp];
+  }
+
+  /* Ensure the first element is a function */
+  lval* first = args[0];
+  if (LVAL_TYPE(first) != LVAL_FUN) {
+    for (int i = 0; i < n; i++) {
+      lval_del(args[i]);
+    }
+    vm.sp -= n;
+    return lval_err("S-Expression does not start with symbol");
+  }
+
+  /* Move the operands off the stack before calling, the builtin may
+     reenter the VM and grow it. Most calls fit the buffer here. */
+  lval* buffer[LVM_ARGS];
+  lval** operands = n-1 <= LVM_ARGS ? buffer : malloc(sizeof(lval*) * (n-1));
+  memcpy(operands, &args[1], sizeof(lval*) * (n-1));
+  vm.sp -= n;
+
+  lval* result = lval_call(first, operands, n-1, env);
+  if (operands != buffer) { free(operands); }
+  return result;
+}
+
+void lvm_enter(lcode* code, int owned, int base, int locals, lval* fun) {
+  if (vm.fp == vm.frame_capacity) { /* Grow geometrically */
+    vm.frame_capacity = vm.frame_capacity ? vm.frame_capacity * 2 : 16;
+    vm.frames = realloc(vm.frames, sizeof(lframe) * vm.frame_capacity);
+  }
+
+  lframe* frame = &vm.frames[vm.fp++];
+  frame->code = code;
+  frame->pc = 0;
+  frame->base = base;
+  frame->owned = owned;
+  frame->locals = locals;
+  frame->fun = fun;
+}
+
+int lvm_is_builtin(lval* x, lbuiltin_fn call) { /* Whether x is the builtin call, lambdas have no fun */
+  return LVAL_TYPE(x) == LVAL_FUN && x->fun && x->fun->call == call;
+}
+
+int lvm_is_eval(int n) {	/* Whether the top n values are a well formed call to eval */
+  lval** args = &vm.stack[vm.sp - n];
+  return n == 2 && lvm_is_builtin(args[0], builtin_eval)
+    && LVAL_TYPE(args[1]) == LVAL_QEXPR;
+}
+
+int lvm_is_if(int n) {		/* Whether the top n values are a well formed call to if */
+  lval** args = &vm.stack[vm.sp - n];
+  return n == 4 && lvm_is_builtin(args[0], builtin_if)
+    && LVAL_TYPE(args[1]) == LVAL_NUM && LVAL_TYPE(args[2]) == LVAL_QEXPR
+    && LVAL_TYPE(args[3]) == LVAL_QEXPR;
+}
+
+int lvm_is_call(int n) {	/* Whether the top n values are a lambda and its arguments */
+  lval** args = &vm.stack[vm.sp - n];
+  return n && LVAL_TYPE(args[0]) == LVAL_FUN && args[0]->lambda && args[0]->lambda->params == n - 1;
+}
+
+void lvm_quote(lframe* frame, lval* form) { /* Push form's operands if the head just pushed is a special form */
+  lval* head = vm.stack[vm.sp-1];
+  if (LVAL_TYPE(head) != LVAL_FUN || !head->fun || !(head->fun->flags & LB_SPECIAL)) {
+    frame->pc++;		/* Skip the jump, the operands are evaluated */
+    return;
+  }
+
+  for (int i = 1; i < form->count; i++) { lvm_push(lval_copy(lval_nth(form, i))); }
 }
 
-lval* builtin_head(lval* qexpr) {
-  LASSERT(qexpr, qexpr->type != LVAL_QEXPR,
-	  "Passed wrong type to 'head'"); /* head was called on the wrong type */
+void lvm_check(lframe* frame) {	/* End the frame with the value just pushed if it is an error */
+  if (LVAL_TYPE(vm.stack[vm.sp-1]) == LVAL_ERR) { frame->pc = frame->code->count; }
+}
 
-  LASSERT(qexpr, qexpr->count == 1,
-	  "Function 'head' passed too many arguments"); /* the function was passed more than one argument */
+int lvm_in_tail(lframe* frame) { /* Whether only jumps to the end are left */
+  int pc = frame->pc;
+  while (pc < frame->code->count && frame->code->instrs[pc].op == OP_JUMP) {
+    pc += 1 + frame->code->instrs[pc].arg;
+  }
+  return pc == frame->code->count;
+}
 
-  LASSERT(qexpr, qexpr->cell[0]->count != 0,
-	  "Function 'head' passed {}"); /* The qexpr is empty */
+lcode* lvm_compile(lval* x, llambda* scope, lenv* env) { /* Compile the Q-expression x as an s-expression */
+  x = lval_own(x);
+  if (LVAL_IS_VEC(x)) { lval_unvec(x); }
+  x->type = LVAL_SEXPR;
+
+  lcode* code = lcode_new();
+  lval_compile(x, code, scope, env);
+  return code;
+}
+
+lcode* lvm_cached(lframe* frame, lval* x, lenv* env) { /* Code for x if it is one of frame's constants */
+  /* An owned frame's code may be freed under the result, and the code
+     of lambdas and top level runs outlives its frames. */
+  if (frame->owned) { return NULL; }
+
+  lcode* code = frame->code;
+  for (int i = 0; i < code->const_count; i++) {
+    if (code->consts[i] != x) { continue; }
+
+    if (!code->subs[i]) {	/* Lives as long as the constant, so off the arena */
+      int arena = mem.arena_active;
+      arena_end();
+      code->subs[i] = lvm_compile(lval_copy(x), frame->fun ? frame->fun->lambda : NULL, env);
+      mem.arena_active = arena;
+    }
+    return code->subs[i];
+  }
+  return NULL;
+}
+
+void lvm_continue(lval* x, lenv* env) {	/* Evaluate Q-expression x in place of the call just popped */
+  lframe* frame = &vm.frames[vm.fp-1];
+
+  /* Branches of if and bodies passed to eval are usually constants of
+     the running code, compile those only once. Symbols in x see the
+     slots of the running lambda. */
+  lcode* next = lvm_cached(frame, x, env);
+  int owned = !next;
+  if (next) {
+    lval_del(x);
+  } else {
+    next = lvm_compile(x, frame->fun ? frame->fun->lambda : NULL, env);
+  }
+
+  if (lvm_in_tail(frame)) {	/* Take the frame over, keeping its slots */
+    if (frame->owned) { lcode_del(frame->code); }
+    frame->code = next;
+    frame->pc = 0;
+    frame->owned = owned;
+  } else {
+    lvm_enter(next, owned, vm.sp, frame->locals, frame->fun);
+  }
+}
+
+void lvm_call(int n) {		/* Start the lambda call on top of the stack */
+  lframe* frame = &vm.frames[vm.fp-1];
+  int start = vm.sp - n;
+
+  if (lvm_in_tail(frame)) {	/* The caller is done, reuse its frame and slots */
+    for (int i = frame->base; i < start; i++) { lval_del(vm.stack[i]); }
+    memmove(&vm.stack[frame->base], &vm.stack[start], sizeof(lval*) * n);
+    vm.sp = frame->base + n;
+    start = frame->base;
+
+    if (frame->owned) { lcode_del(frame->code); }
+    vm.fp--;
+  }
+
+  lval* fun = vm.stack[start];
+  lvm_enter(fun->lambda->code, 0, start, start + 1, fun);
+}
+
+lval* lvm_run(int stop, lenv* env) { /* Run until only stop frames are left */
+  /* Between instructions of the outermost run everything live is on
+     the stacks, nested runs have values held by builtins. */
+  gc.depth++;
+
+  while (vm.fp > stop) {
+    lframe* frame = &vm.frames[vm.fp-1];
+
+    if (lvm_in_tail(frame)) {	/* Done, well formed code leaves exactly one value */
+      lval* result = vm.stack[--vm.sp];
+      while (vm.sp > frame->base) { lval_del(vm.stack[--vm.sp]); }
+      lvm_push(result);
+
+      if (frame->owned) { lcode_del(frame->code); }
+      vm.fp--;
+      if (vm.fp > stop) { lvm_check(&vm.frames[vm.fp-1]); }
+      continue;
+    }
+
+    linstr* in = &frame->code->instrs[frame->pc++];
+    lval* x;
+
+    if (gc.depth == 1) { gc_safepoint(); }
+
+    switch (in->op) {
+    case OP_CONST:
+      lvm_push(lval_copy(frame->code->consts[in->arg]));
+      lvm_check(frame);
+      break;
+    case OP_LOAD:
+      lvm_push(lenv_get(frame->code->consts[in->arg], env));
+      lvm_check(frame);
+      break;
+    case OP_HEAD:
+      x = frame->code->consts[in->arg];
+      lvm_push(lenv_get(LVAL_CELLS(x)[0], env));
+      lvm_check(frame);
+      if (frame->pc < frame->code->count) { lvm_quote(frame, x); }
+      break;
+    case OP_QUOTE:
+      lvm_quote(frame, frame->code->consts[in->arg]);
+      break;
+    case OP_LOCAL:
+      lvm_push(lval_copy(vm.stack[frame->locals + in->arg]));
+      break;
+    case OP_FREE:
+      lvm_push(lval_copy(frame->fun->lambda->free[in->arg]));
+      break;
+    case OP_APPLY:
+      /* Lambdas, eval and if continue in this loop rather than
+	 recursing, so calls in tail position run in constant space */
+      if (lvm_is_call(in->arg)) {
+	lvm_call(in->arg);
+      } else if (lvm_is_eval(in->arg)) {
+	lval* x = vm.stack[--vm.sp];
+	lval_del(vm.stack[--vm.sp]);
+	lvm_continue(x, env);
+      } else if (lvm_is_if(in->arg)) {
+	lval* no = vm.stack[--vm.sp];
+	lval* yes = vm.stack[--vm.sp];
+	lval* cond = vm.stack[--vm.sp];
+	lval_del(vm.stack[--vm.sp]);
+	lval_del(LVAL_NUMBER(cond) ? no : yes);
+	lvm_continue(LVAL_NUMBER(cond) ? yes : no, env);
+	lval_del(cond);
+      } else {
+	lvm_push(lvm_apply(in->arg, env));
+	lvm_check(frame);
+      }
+      break;
+    case OP_FOLD:
+      if (!lcode_stale(frame->code, frame->code->consts[in->arg])) { frame->pc++; }
+      break;
+    case OP_JUMP:
+      frame->pc += in->arg;
+      break;
+    case OP_BRANCH:
+      x = vm.stack[--vm.sp];
+      if (LVAL_TYPE(x) != LVAL_NUM) {
+	lvm_push(lval_err("Function 'if' passed incorrect type"));
+	lvm_check(frame);
+      } else if (!LVAL_NUMBER(x)) {
+	frame->pc += in->arg;
+      }
+      lval_del(x);
+      break;
+    case OP_EVAL:
+      x = vm.stack[--vm.sp];
+      if (LVAL_TYPE(x) == LVAL_QEXPR) {
+	lvm_continue(x, env);
+	break;
+      }
+      lval_del(x);
+      lvm_push(lval_err("Function 'if' passed incorrect type"));
+      lvm_check(frame);
+      break;
+    case OP_AND:
+    case OP_OR:
+      x = vm.stack[--vm.sp];
+      if (LVAL_TYPE(x) != LVAL_NUM) {
+	lvm_push(lval_err(in->op == OP_AND ? "Function 'and' passed incorrect type"
+			  : "Function 'or' passed incorrect type"));
+	lvm_check(frame);
+      } else if (!LVAL_NUMBER(x) == (in->op == OP_AND)) {
+	lvm_push(lval_num(in->op == OP_OR));
+	frame->pc += in->arg;
+      }
+      lval_del(x);
+      break;
+    }
+  }
+
+  lval* result = vm.stack[--vm.sp];
+  gc.depth--;
+  return result;
+}
+
+lval* lvm_exec(lcode* code, lenv* env) {
+  lvm_enter(code, 0, vm.sp, vm.sp, NULL);
+  return lvm_run(vm.fp - 1, env);
+}
+
+lval* lvm_eval(lval* x, lenv* env) { /* Evaluate x in a frame that sees the slots of the running one */
+  if (LVAL_TYPE(x) != LVAL_SYM && LVAL_TYPE(x) != LVAL_SEXPR) { return x; }
+
+  lframe* frame = vm.fp ? &vm.frames[vm.fp-1] : NULL;
+  lval* fun = frame ? frame->fun : NULL;
+  lcode* code = lcode_new();
+  lval_compile(x, code, fun ? fun->lambda : NULL, env);
+
+  lvm_enter(code, 1, vm.sp, frame ? frame->locals : vm.sp, fun);
+  return lvm_run(vm.fp - 1, env);
+}
+
+/* Lambdas */
+llambda* llambda_retain(llambda* lambda) {
+  lambda->refs++;
+  return lambda;
+}
+
+void llambda_release(llambda* lambda) {
+  if (--lambda->refs > 0) { return; }
+
+  for (int i = 0; i < lambda->captured; i++) { lval_del(lambda->free[i]); }
+  lval_del(lambda->formals);
+  lval_del(lambda->body);
+  lcode_del(lambda->code);
+  free(lambda->names);
+  free(lambda->free);
+  free(lambda);
+}
+
+int llambda_slot(llambda* scope, lsym* sym) {
+  for (int i = 0; i < scope->params + scope->captured; i++) {
+    if (scope->names[i] == sym) { return i; }
+  }
+  return -1;
+}
+
+lval* lscope_lookup(lsym* name, lenv* env) { /* Value of a non global variable, NULL if there is none */
+  if (env->parent) {		/* The tree walker binds them in per call environments */
+    for (; env->parent; env = env->parent) {
+      int i = lenv_find_slot(env, name);
+      if (env->entries[i].sym) { return lval_copy(env->entries[i].val); }
+    }
+    return NULL;
+  }
+
+  if (!vm.fp || !vm.frames[vm.fp-1].fun) { return NULL; }
+
+  lframe* frame = &vm.frames[vm.fp-1];
+  llambda* scope = frame->fun->lambda;
+  int slot = llambda_slot(scope, name);
+
+  if (slot < 0) { return NULL; }
+  if (slot < scope->params) { return lval_copy(vm.stack[frame->locals + slot]); }
+  return lval_copy(scope->free[slot - scope->params]);
+}
+
+void llambda_capture_sym(llambda* lambda, lsym* sym, lenv* env) { /* Capture sym if it names a variable of the enclosing lambda */
+  if (llambda_slot(lambda, sym) >= 0) { return; }
+
+  lval* val = lscope_lookup(sym, env);
+  if (!val) { return; }
+
+  int n = lambda->params + lambda->captured;
+  lambda->names = realloc(lambda->names, sizeof(lsym*) * (n + 1));
+  lambda->names[n] = sym;
+  lambda->free = realloc(lambda->free, sizeof(lval*) * (lambda->captured + 1));
+  lambda->free[lambda->captured++] = val;
+}
+
+/* Capture every symbol in body, quoted or not, that names a variable of
+   the enclosing lambda. Quoted ones may be evaluated later by eval or if.
+   Bodies can nest deeper than the C stack allows, so the lists still to
+   walk are kept on a stack of their own, last child first. */
+void llambda_capture(llambda* lambda, lval* body, lenv* env) {
+  int count = 1, capacity = 16;
+  lval** todo = malloc(sizeof(lval*) * capacity);
+  todo[0] = body;
+
+  while (count) {
+    lval* x = todo[--count];
+    if (LVAL_TYPE(x) == LVAL_SYM) { llambda_capture_sym(lambda, x->sym, env); }
+    if (LVAL_TYPE(x) != LVAL_SEXPR && LVAL_TYPE(x) != LVAL_QEXPR) { continue; }
+
+    if (count + x->count > capacity) { /* Grow geometrically */
+      while (count + x->count > capacity) { capacity *= 2; }
+      todo = realloc(todo, sizeof(lval*) * capacity);
+    }
+    for (int i = x->count - 1; i >= 0; i--) { todo[count++] = lval_nth(x, i); }
+  }
+  free(todo);
+}
+
+lval* builtin_lambda(lval** args, int argc, lenv* env) { /* (\ {formals} {body}) */
+  (void)argc;
+  lval* err = lval_eval_operands(args, 2, env);
+  if (err) { return err; }
+  LASSERT(LVAL_TYPE(args[0]) == LVAL_QEXPR && LVAL_TYPE(args[1]) == LVAL_QEXPR,
+	  "Function '\\' passed incorrect type");
+
+  lval* formals = args[0];
+  for (int i = 0; i < formals->count; i++) {
+    LASSERT(LVAL_TYPE(lval_nth(formals, i)) == LVAL_SYM,
+	    "Cannot define non-symbol");
+  }
+
+  /* Lambdas outlive the evaluation, keep them and everything they hold out of the arena */
+  int arena = mem.arena_active;
+  arena_end();
+
+  llambda* lambda = malloc(sizeof(llambda));
+  lambda->refs = 1;
+  lambda->params = formals->count;
+  lambda->captured = 0;
+  lambda->names = malloc(sizeof(lsym*) * formals->count);
+  lambda->free = NULL;
+  lambda->marked = 0;
+  for (int i = 0; i < formals->count; i++) { lambda->names[i] = lval_nth(formals, i)->sym; }
+
+  lambda->formals = lval_copy(formals);
+  lambda->body = lval_copy(args[1]);
+  llambda_capture(lambda, lambda->body, env);
+
+  lval* body = lval_own(lval_copy(lambda->body));
+  if (LVAL_IS_VEC(body)) { lval_unvec(body); }
+  body->type = LVAL_SEXPR;
+  lambda->code = lcode_new();
+  lval_compile(body, lambda->code, lambda, env);
+
+  if (arena) { arena_begin(); }
+
+  return lval_lambda(lambda);
+}
+
+lenv* lval_bind_tree(lval* fun, lval** args, lenv* env) { /* Bind the arguments and captured variables by name */
+  llambda* lambda = fun->lambda;
+  lenv* local = lenv_new();
+  while (env->parent) { env = env->parent; }
+  local->parent = env;		/* Everything else is global */
+
+  for (int i = 0; i < lambda->params; i++) {
+    lenv_insert(lval_nth(lambda->formals, i), local, args[i]);
+    lval_del(args[i]);
+  }
+  for (int i = 0; i < lambda->captured; i++) {
+    lval* sym = lval_sym(lambda->names[lambda->params + i]->name);
+    lenv_insert(sym, local, lambda->free[i]);
+    lval_del(sym);
+  }
+  return local;
+}
+
+lval* lval_body(llambda* lambda) {
+  lval* body = lval_own(lval_copy(lambda->body));
+  if (LVAL_IS_VEC(body)) { lval_unvec(body); }
+  body->type = LVAL_SEXPR;
+  return body;
+}
+
+lval* lval_call_tree(lval* fun, lval** args, lenv* env) { /* Bind the arguments by name, then walk the body */
+  lenv* local = lval_bind_tree(fun, args, env);
+  lval* body = lval_body(fun->lambda);
+  lval_del(fun);
+
+  lval* result = lval_eval(body, local);
+  lenv_del(local);
+  return result;
+}
+
+int lbuiltin_accepts(lbuiltin* builtin, int i, lval* arg) { /* Whether arg may be argument i */
+  int n = strlen(builtin->types);
+  switch (builtin->types[i < n ? i : n-1]) {
+  case 'n': return LVAL_TYPE(arg) == LVAL_NUM;
+  case 'q': return LVAL_TYPE(arg) == LVAL_QEXPR;
+  default: return 1;
+  }
+}
+
+/* Special forms get their operands as written from either engine, the
+   VM looks at the head of a call before evaluating the operands. They
+   are evaluated in the caller's frame, where its lambda's slots are. */
+lval* lval_eval_operand(lval* x, lenv* env) {
+  return engine == ENGINE_TREE ? lval_eval(x, env) : lvm_eval(x, env);
+}
+
+lval* lval_eval_operands(lval** args, int argc, lenv* env) { /* Evaluate args in place and in order, returning the first error */
+  for (int i = 0; i < argc; i++) {
+    args[i] = lval_eval_operand(args[i], env);
+    if (LVAL_TYPE(args[i]) != LVAL_ERR) { continue; }
+
+    lval* err = args[i];
+    args[i] = NULL;
+    return err;
+  }
+  return NULL;
+}
+
+lval* lval_call_builtin(lbuiltin* builtin, lval** args, int argc, lenv* env) {
+  lval* result = NULL;
+
+  if (argc < builtin->min_args || (builtin->max_args >= 0 && argc > builtin->max_args)) {
+    result = lval_err(builtin->arity_err);
+  }
+  for (int i = 0; !result && i < argc; i++) {
+    if (!lbuiltin_accepts(builtin, i, args[i])) { result = lval_err(builtin->type_err); }
+  }
+  if (!result) { result = builtin->call(args, argc, env); }
+
+  /* Free what the builtin did not take over */
+  for (int i = 0; i < argc; i++) {
+    if (args[i]) { lval_del(args[i]); }
+  }
+  return result;
+}
+
+int lval_is_nullary(lval* val) {
+  return LVAL_TYPE(val) == LVAL_FUN && (val->fun || val->lambda->params == 0);
+}
+
+lval* lval_call(lval* fun, lval** args, int argc, lenv* env) {
+  if (fun->fun) {		/* A builtin */
+    lval* result = lval_call_builtin(fun->fun, args, argc, env);
+    lval_del(fun);
+    return result;
+  }
+
+  if (argc != fun->lambda->params) {
+    lval_del(fun);
+    for (int i = 0; i < argc; i++) { lval_del(args[i]); }
+    return lval_err("Function passed wrong number of arguments");
+  }
+
+  if (engine == ENGINE_TREE) { return lval_call_tree(fun, args, env); }
+
+  /* Run it in a frame of its own, with the arguments in its slots */
+  int base = vm.sp;
+  lvm_push(fun);
+  for (int i = 0; i < argc; i++) { lvm_push(args[i]); }
+
+  lvm_enter(fun->lambda->code, 0, base, base + 1, fun);
+  return lvm_run(vm.fp - 1, env);
+}
+
+/* Garbage collection */
+void gc_add_root(lenv* env) {
+  gc.root_count++;
+  gc.roots = realloc(gc.roots, sizeof(lenv*) * gc.root_count);
+  gc.roots[gc.root_count-1] = env;
+}
+
+void gc_remove_root(lenv* env) {
+  for (int i = 0; i < gc.root_count; i++) {
+    if (gc.roots[i] == env) {
+      gc.roots[i] = gc.roots[--gc.root_count];
+      return;
+    }
+  }
+}
+
+struct {
+  int count;
+  int capacity;
+  lval** vals;
+} gc_marks = { 0, 0, NULL };	/* Values marked but not yet scanned */
+
+void gc_mark_lambda(llambda* lambda) { /* Shared lambdas are only scanned once per collection */
+  if (lambda->marked == gc.collections + 1) { return; }
+  lambda->marked = gc.collections + 1;
+
+  gc_mark(lambda->formals);
+  gc_mark(lambda->body);
+  for (int i = 0; i < lambda->captured; i++) { gc_mark(lambda->free[i]); }
+  gc_mark_code(lambda->code);
+}
+
+void gc_mark_code(lcode* code) { /* Constants of code and everything compiled from them */
+  for (int i = 0; i < code->const_count; i++) {
+    gc_mark(code->consts[i]);
+    if (code->subs[i]) { gc_mark_code(code->subs[i]); }
+  }
+}
+
+void gc_mark(lval* val) {
+  if (LVAL_IS_IMM(val) || val->flags & LVAL_F_MARK) { return; }
+  val->flags |= LVAL_F_MARK;
 
-  lval* hd = lval_take(qexpr, 0);
+  if (val->type == LVAL_FUN && val->lambda) { gc_mark_lambda(val->lambda); }
+  if (val->type != LVAL_SEXPR && val->type != LVAL_QEXPR) { return; }
 
-  while (hd->count > 1) { lval_del(lval_pop(hd, hd->count-1)); }
+  if (gc_marks.count == gc_marks.capacity) {
+    gc_marks.capacity = gc_marks.capacity ? gc_marks.capacity * 2 : 256;
+    gc_marks.vals = realloc(gc_marks.vals, sizeof(lval*) * gc_marks.capacity);
+  }
+  gc_marks.vals[gc_marks.count++] = val;
+}
+
+void gc_mark_vec(lvec* vec) {	/* Shared subtrees are only scanned once per collection */
+  if (vec->marked == gc.collections + 1) { return; }
+  vec->marked = gc.collections + 1;
+
+  for (int i = 0; i < vec->count; i++) {
+    if (vec->height) { gc_mark_vec(vec->kids[i]); } else { gc_mark(vec->items[i]); }
+  }
+}
+
+void gc_mark_roots(void) {
+  for (int i = 0; i < gc.root_count; i++) {
+    lenv* env = gc.roots[i];
+    for (int j = 0; j < env->capacity; j++) {
+      if (env->entries[j].sym) { gc_mark(env->entries[j].val); }
+    }
+  }
+
+  for (int i = 0; i < vm.sp; i++) { gc_mark(vm.stack[i]); }
+
+  for (int i = 0; i < vm.fp; i++) {
+    gc_mark_code(vm.frames[i].code);
+  }
+
+  /* Scan children without recursing so deep lists are fine */
+  while (gc_marks.count) {
+    lval* val = gc_marks.vals[--gc_marks.count];
+    if (LVAL_IS_VEC(val)) { gc_mark_vec(val->vec); continue; }
+    for (int i = 0; i < val->count; i++) { gc_mark(LVAL_CELLS(val)[i]); }
+  }
+}
+
+void gc_sweep(void) {
+  for (lslab* slab = mem.slabs; slab; slab = slab->next) {
+    int used = slab == mem.slabs ? mem.slab_used : LSLAB_NODES;
+
+    for (int i = 0; i < used; i++) {
+      lval* val = &slab->nodes[i];
+      if (val->flags & LVAL_F_FREE) { continue; }
+
+      if (val->flags & LVAL_F_MARK) {
+	val->flags &= ~LVAL_F_MARK;
+	continue;
+      }
+
+      /* Unreachable, free what it owns but not its children, they are swept on their own */
+      if (val->type == LVAL_ERR) { lstr_free(val->err, val); }
+      if (val->type == LVAL_FUN && val->lambda) { llambda_release(val->lambda); }
+      if (val->type == LVAL_SEXPR || val->type == LVAL_QEXPR) {
+	if (LVAL_IS_VEC(val)) { lvec_release(val->vec); } else { lval_resize(val, 0); }
+      }
+      lval_free(val);
+      gc.freed++;
+    }
+  }
+}
+
+void gc_collect(void) {
+  clock_t start = clock();
+
+  gc_mark_roots();
+  gc_sweep();
+
+  gc.collections++;
+  gc.allocated = 0;
+  gc.threshold = mem.vals_in_use * 2 > GC_MIN_THRESHOLD ? mem.vals_in_use * 2 : GC_MIN_THRESHOLD;
+
+  gc.last_pause = (long) ((clock() - start) * 1000000.0 / CLOCKS_PER_SEC);
+  gc.total_pause += gc.last_pause;
+  if (gc.last_pause > gc.max_pause) { gc.max_pause = gc.last_pause; }
+}
+
+void gc_safepoint(void) {
+  if (use_gc && gc.allocated >= gc.threshold) { gc_collect(); }
+}
+
+lval* builtin_gc_stats(lval** args, int argc, lenv* env) { /* {collections n heap n freed n last-pause-us n max-pause-us n total-pause-us n} */
+  (void)args; (void)argc; (void)env;
+  lval* stats = lval_qexpr();
+  stats = lval_add(stats, lval_sym("collections"));
+  stats = lval_add(stats, lval_num(gc.collections));
+  stats = lval_add(stats, lval_sym("heap"));
+  stats = lval_add(stats, lval_num(mem.vals_in_use));
+  stats = lval_add(stats, lval_sym("freed"));
+  stats = lval_add(stats, lval_num(gc.freed));
+  stats = lval_add(stats, lval_sym("last-pause-us"));
+  stats = lval_add(stats, lval_num(gc.last_pause));
+  stats = lval_add(stats, lval_sym("max-pause-us"));
+  stats = lval_add(stats, lval_num(gc.max_pause));
+  stats = lval_add(stats, lval_sym("total-pause-us"));
+  stats = lval_add(stats, lval_num(gc.total_pause));
+  return stats;
+}
+
+lval* lval_run(lval* val, lenv* env) {
+  if (engine == ENGINE_TREE) {
+    return lval_eval(val, env);
+  }
+
+  lcode* code = lcode_new();
+  lval_compile(val, code, NULL, env);
+
+  lval* result = lvm_exec(code, env);
+  lcode_del(code);
+  return result;
+}
+
+lval* lval_pop(lval* sexpr, int i) { /* Get the element at i and remove it from the sexpr */
+  if (LVAL_IS_VEC(sexpr)) { lval_unvec(sexpr); }
+
+  lval** cells = LVAL_CELLS(sexpr);
+  lval* elem = cells[i];
+
+  memmove(&cells[i], &cells[i+1],  /* Move memory over the top */
+	  sizeof(lval*) * (sexpr->count-i-1));
+
+  lval_resize(sexpr, sexpr->count - 1); /* Decrease count of items, realloc the memory used */
+  return elem;			/* Return the element popped */
+}
 
-  return hd;
+lval* lval_take(lval* sexpr, int i) {		/* Like lval_pop but deletes the list from which it was taken */
+  lval* elem = lval_pop(sexpr, i);
+  lval_del(sexpr);
+  return elem;
 }
 
-lval* builtin_tail(lval* qexpr) {
-  LASSERT(qexpr, qexpr->type != LVAL_QEXPR,
-	  "Passed wrong type to 'tail'"); /* head was called on the wrong type */
+lval* builtin_head(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  LASSERT(args[0]->count != 0,
+	  "Function 'head' passed {}"); /* The qexpr is empty */
 
-  LASSERT(qexpr, qexpr->count == 1,
-	  "Function 'tail' passed too many arguments"); /* the function was passed more than one argument */
+  /* Build the one element list rather than deleting the rest one by one */
+  return lval_add(lval_qexpr(), lval_copy(lval_nth(args[0], 0)));
+}
 
-  LASSERT(qexpr, qexpr->cell[0]->count != 0,
+lval* builtin_tail(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  LASSERT(args[0]->count != 0,
 	  "Function 'tail' passed {}"); /* The qexpr is empty */
 
-  lval* tl = lval_pop(qexpr, 0);
+  if (lval_use_vec(args[0])) {	/* A view sharing the vector, O(1) */
+    return lval_slice(args[0], 1, args[0]->count);
+  }
+
+  lval* tl = lval_own(args[0]);
+  args[0] = NULL;
   lval_del(lval_pop(tl, 0));
 
   return tl;
 }
 
-lval* builtin_list(lval* sexpr) { /* Convert sexpr to qexpr(list). */
-  sexpr->type = LVAL_QEXPR;
-  return sexpr;
-}
-
-lval* builtin_len(lval* qexpr) {
-  LASSERT(qexpr, qexpr->type != LVAL_QEXPR,
-	  "Function 'len' called on the wrong type.");
+lval* builtin_nth(lval** args, int argc, lenv* env) { /* (nth {list} i), the element at index i */
+  (void)argc; (void)env;
+  lval* list = args[0];
+  long i = LVAL_NUMBER(args[1]);
+  LASSERT(i >= 0 && i < list->count,
+	  "Function 'nth' index out of range");
 
-  LASSERT(qexpr, qexpr->count == 1,
-	  "Function 'len' passed too many arguments");
+  return lval_copy(lval_nth(list, i));
+}
 
-  int count = qexpr->cell[0]->count;
-  lval_del(qexpr);
+lval* builtin_list(lval** args, int argc, lenv* env) { /* The operands as a qexpr(list). */
+  (void)env;
+  lval* list = lval_qexpr();
+  lval_resize(list, argc);
+  for (int i = 0; i < argc; i++) {
+    LVAL_CELLS(list)[i] = args[i];
+    args[i] = NULL;
+  }
+  return list;
+}
 
-  return lval_num(count);
+lval* builtin_len(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(args[0]->count);
 }
 
-lval* builtin_init(lval* qexpr) {
-  LASSERT(qexpr, qexpr->type != LVAL_QEXPR,
-	  "Function 'init' called with wrong arguments");
-  LASSERT(qexpr, qexpr->count == 1,
-	  "Function 'init' called with too many arguments");
-  LASSERT(qexpr, qexpr->cell[0]->count != 0,
+lval* builtin_init(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  LASSERT(args[0]->count != 0,
 	  "Function 'init' called with {}");
 
+  if (lval_use_vec(args[0])) {
+    return lval_slice(args[0], 0, args[0]->count - 1);
+  }
+
   /* Delete the last element */
-  lval* list = lval_take(qexpr, 0);
-  lval_pop(list, list->count-1);
+  lval* list = lval_own(args[0]);
+  args[0] = NULL;
+  lval_del(lval_pop(list, list->count-1));
 
   return list;
 }
 
-lval* builtin_cons(lval* sexpr) {
-  lval* qexpr = lval_qexpr();
-
-  while (sexpr->count) {
-    qexpr = lval_add(qexpr, lval_pop(sexpr, 0));
-  }
-  lval_del(sexpr);
-  /* while (list->count) { */
-  /*   first = lval_join(first, lval_pop(list, 0)); */
-  /* } */
-  
-  /* first->type = LVAL_QEXPR; */
-  return qexpr;
+lval* builtin_cons(lval** args, int argc, lenv* env) { /* The operands are the list */
+  return builtin_list(args, argc, env);
 }
 
-lval* builtin_eval(lval* qexpr) { /* Convert qexpr to sexpr then evaluate. */
-  LASSERT(qexpr, qexpr->count == 1,
-	  "Function 'eval' passed too many arguments");
-  LASSERT(qexpr, qexpr->cell[0]->type == LVAL_QEXPR,
-	  "Function 'eval' passed incorrect type");
-  
-  lval* x = lval_take(qexpr, 0);
+lval* builtin_eval(lval** args, int argc, lenv* env) { /* Convert qexpr to sexpr then evaluate. */
+  (void)argc;
+  lval* x = lval_own(args[0]);
+  args[0] = NULL;
+  if (LVAL_IS_VEC(x)) { lval_unvec(x); } /* Only Q-expressions are vectors */
 
   x->type = LVAL_SEXPR;
-  return lval_eval(x);  
+  return lval_run(x, env);  
 }
 
-lval* builtin_join(lval* sexpr) {
-  for (int i = 0; i < sexpr->count; i++) {
-    LASSERT(sexpr, sexpr->cell[i]->type == LVAL_QEXPR, "Function 'join' passed incorrect type");
+lval* builtin_join(lval** args, int argc, lenv* env) {
+  (void)env;
+  /* Concatenate vectors once any list is one or the result is long */
+  int count = 0, vec = 0;
+  for (int i = 0; i < argc; i++) {
+    count += args[i]->count;
+    vec |= LVAL_IS_VEC(args[i]);
   }
 
-  lval* first = lval_pop(sexpr, 0);
+  if (!mem.arena_active && (vec || count >= LVEC_MIN)) {
+    lvec* joined = NULL;
+
+    for (int i = 0; i < argc; i++) {
+      lval* list = args[i];
+      if (list->count == 0) { continue; }
+
+      lvec* part;
+      if (lval_use_vec(list)) {
+	part = lval_as_vec(list);
+      } else {			/* Short lists are copied into a fresh vector */
+	lval** items = malloc(sizeof(lval*) * list->count);
+	for (int j = 0; j < list->count; j++) { items[j] = lval_copy(LVAL_CELLS(list)[j]); }
+	part = lvec_from(items, list->count);
+	free(items);
+      }
+
+      if (joined) {
+	lvec* both = lvec_concat(joined, part);
+	lvec_release(joined);
+	lvec_release(part);
+	joined = both;
+      } else {
+	joined = part;
+      }
+    }
 
-  while (sexpr->count) {
-    first = lval_join(first, lval_pop(sexpr, 0));
+    return joined ? lval_vec(joined) : lval_qexpr();
+  }
+
+  lval* first = lval_own(args[0]);
+  args[0] = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    first = lval_join(first, args[i]);
+    args[i] = NULL;
   }
 
-  lval_del(sexpr);
   return first;
 }
 
 lval* lval_join(lval* first, lval* second) {
-  while (second->count) {
-    first = lval_add(first, lval_pop(second, 0));
+  if (LVAL_IS_VEC(second)) { lval_unvec(second); }
+
+  int count = first->count;
+  lval_resize(first, count + second->count);
+
+  /* Splice the cells in one go. A shared second keeps its elements, so
+     take a reference to each, an unshared one gives them up. */
+  memcpy(&LVAL_CELLS(first)[count], LVAL_CELLS(second), sizeof(lval*) * second->count);
+  if (second->refs > 1) {
+    for (int i = count; i < first->count; i++) {
+      LVAL_CELLS(first)[i] = lval_copy(LVAL_CELLS(first)[i]);
+    }
+  } else {
+    lval_resize(second, 0);
   }
 
-  /* Delete empty second and return the first */
   lval_del(second);
   return first;
 }
 
-lval* builtin(char* func, lval* operands) {
-  if (strcmp(func, "list") == 0) return builtin_list(operands);
-  if (strcmp(func, "head") == 0) return builtin_head(operands);
-  if (strcmp(func, "tail") == 0) return builtin_tail(operands);
-  if (strcmp(func, "join") == 0) return builtin_join(operands);
-  if (strcmp(func, "eval") == 0) return builtin_eval(operands);
-  if (strcmp(func, "len") == 0) return builtin_len(operands);
-  if (strcmp(func, "init") == 0) return builtin_init(operands);
-  if (strcmp(func, "cons") == 0) return builtin_cons(operands);
-  if (strstr(func, "+-/*%") == 0) return builtin_op(func, operands);
-  lval_del(operands);
-  return lval_err("Unsupported function");
-}
+lval* builtin_def(lval** args, int argc, lenv* env) { /* (def {names} values...), always global */
+  /* Check the names before evaluating any value */
+  lval* err = lval_eval_operands(args, 1, env);
+  if (err) { return err; }
+  LASSERT(LVAL_TYPE(args[0]) == LVAL_QEXPR,
+	  "Function 'def' passed incorrect type");
+
+  lval* syms = args[0];
+  for (int i = 0; i < syms->count; i++) {
+    LASSERT(LVAL_TYPE(lval_nth(syms, i)) == LVAL_SYM,
+	    "Function 'def' cannot define non-symbol");
+  }
+  LASSERT(syms->count == argc - 1,
+	  "Function 'def' cannot define incorrect number of values to symbols");
 
-lval* builtin_op(char* op, lval* operands) {
-  /* Check that all operands are numbers */
-  for (int i = 0; i < operands->count; i++) {
-    if (operands->cell[i]->type != LVAL_NUM) {
-      lval_del(operands);
-      return lval_err("Cannot operate on a non-number");
-    }
+  err = lval_eval_operands(&args[1], argc - 1, env);
+  if (err) { return err; }
+
+  while (env->parent) { env = env->parent; }
+  for (int i = 0; i < syms->count; i++) {
+    lenv_insert(lval_nth(syms, i), env, args[i+1]);
   }
 
-  lval* first_arg = lval_pop(operands, 0);
+  return lval_sexpr();
+}
+
+lval* lval_if_branch(lval** args, lenv* env) { /* Takes over the branch, the caller frees the other operands */
+  lval* err = lval_eval_operands(args, 1, env);
+  if (err) { return err; }
+  LASSERT(LVAL_TYPE(args[0]) == LVAL_NUM,
+	  "Function 'if' passed incorrect type");
 
-  if (strcmp(op, "-") == 0 && operands->count == 0) { /* Negate the number */
-    first_arg->num = -first_arg->num;
-    return first_arg;
+  int branch = LVAL_NUMBER(args[0]) ? 1 : 2;
+  err = lval_eval_operands(&args[branch], 1, env);
+  if (err) { return err; }
+  LASSERT(LVAL_TYPE(args[branch]) == LVAL_QEXPR,
+	  "Function 'if' passed incorrect type");
+
+  lval* x = lval_own(args[branch]);
+  args[branch] = NULL;
+  if (LVAL_IS_VEC(x)) { lval_unvec(x); }
+
+  x->type = LVAL_SEXPR;
+  return x;
+}
+
+lval* builtin_if(lval** args, int argc, lenv* env) { /* (if cond {then} {else}), only the branch taken is evaluated */
+  (void)argc;
+  lval* x = lval_if_branch(args, env);
+  if (LVAL_TYPE(x) == LVAL_ERR) { return x; }
+  return lval_eval_operand(x, env);
+}
+
+lval* builtin_and(lval** args, int argc, lenv* env) { /* (and x...), 0 at the first x that is 0 */
+  for (int i = 0; i < argc; i++) {
+    lval* err = lval_eval_operands(&args[i], 1, env);
+    if (err) { return err; }
+    LASSERT(LVAL_TYPE(args[i]) == LVAL_NUM,
+	    "Function 'and' passed incorrect type");
+    if (!LVAL_NUMBER(args[i])) { return lval_num(0); }
+  }
+  return lval_num(1);
+}
+
+lval* builtin_or(lval** args, int argc, lenv* env) { /* (or x...), 1 at the first x that is not 0 */
+  for (int i = 0; i < argc; i++) {
+    lval* err = lval_eval_operands(&args[i], 1, env);
+    if (err) { return err; }
+    LASSERT(LVAL_TYPE(args[i]) == LVAL_NUM,
+	    "Function 'or' passed incorrect type");
+    if (LVAL_NUMBER(args[i])) { return lval_num(1); }
   }
+  return lval_num(0);
+}
 
-  while (operands->count > 0) {
-    /* Pop the next element */
-    lval* second_arg = lval_pop(operands, 0);
+int lval_eq(lval* x, lval* y) {
+  if (LVAL_TYPE(x) != LVAL_TYPE(y)) { return 0; }
 
-    if (strcmp(op, "+") == 0) first_arg->num += second_arg->num;
-    else if (strcmp(op, "-") == 0) first_arg->num -= second_arg->num;
-    else if (strcmp(op, "*") == 0) first_arg->num *= second_arg->num;
-    else if (strcmp(op, "%") == 0) first_arg->num %= second_arg->num;
-    else if (strcmp(op, "/") == 0) {
-      if (second_arg->num == 0)    /* Second number is zero return error */
-	return lval_err("Division by zero");
-      first_arg->num /= second_arg->num;
+  switch (LVAL_TYPE(x)) {
+  case LVAL_NUM: return LVAL_NUMBER(x) == LVAL_NUMBER(y);
+  case LVAL_ERR: return strcmp(x->err, y->err) == 0;
+  case LVAL_SYM: return x->sym == y->sym;
+  case LVAL_FUN:
+    if (x->fun || y->fun) { return x->fun == y->fun; }
+    return lval_eq(x->lambda->formals, y->lambda->formals) && lval_eq(x->lambda->body, y->lambda->body);
+  case LVAL_SEXPR:
+  case LVAL_QEXPR:
+    if (x->count != y->count) { return 0; }
+    for (int i = 0; i < x->count; i++) {
+      if (!lval_eq(lval_nth(x, i), lval_nth(y, i))) { return 0; }
     }
+    return 1;
+  }
+
+  return 0;
+}
+
+lval* builtin_eq(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(lval_eq(args[0], args[1]));
+}
+
+lval* builtin_ne(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(!lval_eq(args[0], args[1]));
+}
+
+lval* builtin_lt(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(LVAL_NUMBER(args[0]) < LVAL_NUMBER(args[1]));
+}
+
+lval* builtin_gt(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(LVAL_NUMBER(args[0]) > LVAL_NUMBER(args[1]));
+}
+
+lval* builtin_le(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(LVAL_NUMBER(args[0]) <= LVAL_NUMBER(args[1]));
+}
+
+lval* builtin_ge(lval** args, int argc, lenv* env) {
+  (void)argc; (void)env;
+  return lval_num(LVAL_NUMBER(args[0]) >= LVAL_NUMBER(args[1]));
+}
+
+/* Arithmetic. Each operator has its own builtin so the loop over the
+   operands does no dispatch. */
+lval* builtin_add(lval** args, int argc, lenv* env) {
+  (void)env;
+  long acc = 0;
+  for (int i = 0; i < argc; i++) { acc += LVAL_NUMBER(args[i]); }
+
+  return lval_num(acc);
+}
+
+lval* builtin_sub(lval** args, int argc, lenv* env) {
+  (void)env;
+  long acc = LVAL_NUMBER(args[0]);
+  if (argc == 1) { acc = -acc; } /* Negate the number */
+  for (int i = 1; i < argc; i++) { acc -= LVAL_NUMBER(args[i]); }
+
+  return lval_num(acc);
+}
+
+lval* builtin_mul(lval** args, int argc, lenv* env) {
+  (void)env;
+  long acc = 1;
+  for (int i = 0; i < argc; i++) { acc *= LVAL_NUMBER(args[i]); }
+
+  return lval_num(acc);
+}
+
+lval* builtin_div(lval** args, int argc, lenv* env) {
+  (void)env;
+  long acc = LVAL_NUMBER(args[0]);
+  for (int i = 1; i < argc; i++) {
+    LASSERT(LVAL_NUMBER(args[i]) != 0, "Division by zero");
+    LASSERT(acc != LONG_MIN || LVAL_NUMBER(args[i]) != -1, "Integer overflow");
+    acc /= LVAL_NUMBER(args[i]);
+  }
+
+  return lval_num(acc);
+}
 
-    /* Delete the second argument as we don't need it. */
-    lval_del(second_arg);
+lval* builtin_mod(lval** args, int argc, lenv* env) {
+  (void)env;
+  long acc = LVAL_NUMBER(args[0]);
+  for (int i = 1; i < argc; i++) {
+    LASSERT(LVAL_NUMBER(args[i]) != 0, "Division by zero");
+    LASSERT(acc != LONG_MIN || LVAL_NUMBER(args[i]) != -1, "Integer overflow");
+    acc %= LVAL_NUMBER(args[i]);
   }
 
-  lval_del(operands);
-  return first_arg;
+  return lval_num(acc);
+}
+
+/* Every builtin, the symbol it is bound to, its LB_* flags and what it
+   may be passed. Types are n for a number, q for a Q-expression and
+   * for anything, the last one applies to the rest of the arguments. */
+#define LERR_NUMS "Cannot operate on a non-number"
+#define LERR_NONE "No operands passed"
+
+lbuiltin builtins[] = {
+  { "list", builtin_list, LB_PURE, 0, -1, "*", NULL, NULL },
+  { "head", builtin_head, LB_PURE, 1, 1, "q", "Function 'head' passed too many arguments", "Passed wrong type to 'head'" },
+  { "tail", builtin_tail, LB_PURE, 1, 1, "q", "Function 'tail' passed too many arguments", "Passed wrong type to 'tail'" },
+  { "join", builtin_join, LB_PURE, 1, -1, "q", "Function 'join' passed no arguments", "Function 'join' passed incorrect type" },
+  { "eval", builtin_eval, 0, 1, 1, "q", "Function 'eval' passed too many arguments", "Function 'eval' passed incorrect type" },
+  { "len",  builtin_len, LB_PURE, 1, 1, "q", "Function 'len' passed too many arguments", "Function 'len' called on the wrong type." },
+  { "init", builtin_init, LB_PURE, 1, 1, "q", "Function 'init' called with too many arguments", "Function 'init' called with wrong arguments" },
+  { "cons", builtin_cons, LB_PURE, 0, -1, "*", NULL, NULL },
+  { "nth",  builtin_nth, LB_PURE, 2, 2, "qn", "Function 'nth' passed wrong number of arguments", "Function 'nth' passed incorrect type" },
+  { "def",  builtin_def, LB_SPECIAL, 1, -1, "*", "Function 'def' passed incorrect type", NULL },
+  { "\\",   builtin_lambda, LB_SPECIAL, 2, 2, "*", "Function '\\' passed wrong number of arguments", NULL },
+  { "if",   builtin_if, LB_SPECIAL, 3, 3, "*", "Function 'if' passed wrong number of arguments", NULL },
+  { "and",  builtin_and, LB_SPECIAL, 0, -1, "*", NULL, NULL },
+  { "or",   builtin_or, LB_SPECIAL, 0, -1, "*", NULL, NULL },
+  { "==",   builtin_eq, LB_PURE, 2, 2, "*", "Function '==' passed wrong number of arguments", NULL },
+  { "!=",   builtin_ne, LB_PURE, 2, 2, "*", "Function '!=' passed wrong number of arguments", NULL },
+  { "<",    builtin_lt, LB_PURE, 2, 2, "n", "Function '<' passed wrong number of arguments", "Function '<' passed incorrect type" },
+  { ">",    builtin_gt, LB_PURE, 2, 2, "n", "Function '>' passed wrong number of arguments", "Function '>' passed incorrect type" },
+  { "<=",   builtin_le, LB_PURE, 2, 2, "n", "Function '<=' passed wrong number of arguments", "Function '<=' passed incorrect type" },
+  { ">=",   builtin_ge, LB_PURE, 2, 2, "n", "Function '>=' passed wrong number of arguments", "Function '>=' passed incorrect type" },
+  { "+",    builtin_add, LB_PURE, 1, -1, "n", LERR_NONE, LERR_NUMS },
+  { "-",    builtin_sub, LB_PURE, 1, -1, "n", LERR_NONE, LERR_NUMS },
+  { "*",    builtin_mul, LB_PURE, 1, -1, "n", LERR_NONE, LERR_NUMS },
+  { "/",    builtin_div, LB_PURE, 1, -1, "n", LERR_NONE, LERR_NUMS },
+  { "%",    builtin_mod, LB_PURE, 1, -1, "n", LERR_NONE, LERR_NUMS },
+  { "mem-stats", builtin_mem_stats, 0, 0, 0, "*", "Function 'mem-stats' passed too many arguments", NULL },
+  { "gc-stats", builtin_gc_stats, 0, 0, 0, "*", "Function 'gc-stats' passed too many arguments", NULL },
+  { "lookup-stats", builtin_lookup_stats, 0, 0, 0, "*", "Function 'lookup-stats' passed too many arguments", NULL },
+  { NULL }
+};
+
+void lenv_add_builtins(lenv* env) {
+  for (int i = 0; builtins[i].name; i++) {
+    lval* sym = lval_sym(builtins[i].name);
+    lval* fun = lval_fun(&builtins[i]);
+    lenv_insert(sym, env, fun);
+    lval_del(sym);
+    lval_del(fun);
+  }
 }
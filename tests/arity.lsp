@@ -0,0 +1,12 @@
+(def {f} (\ {a b} {+ a b}))
+(f 1)
+(f 1 2 3)
+(f)
+(f 1 2)
+(def {g} (\ {} {10}))
+(g 1)
+(g)
+(mem-stats 1)
+(gc-stats 1 2)
+(lookup-stats {})
+(len (gc-stats))
@@ -0,0 +1,222 @@
+/* Benchmarks of lishp's internals, built by run.sh against repl.c with
+ * its main renamed out of the way. Each prints the seconds of processor
+ * time its measured part took.
+ *
+ *   bench lookup n             10^6 lookups in an environment of n bindings
+ *   bench add n [--vm|--tree]  1000 evaluations of (+ 1 2 ... n)
+ *   bench join n               20 joins of two lists of n numbers
+ *   bench head n               20 heads of a list of n numbers
+ *   bench fib n [--vm|--tree]  a recursive (fib n), parameters in slots on
+ *                              the VM and bound by name on the tree walker
+ *   bench print n              printing a list of n numbers of both signs
+ *                              to /dev/null
+ *   bench read file [--ast-reader|--hand-reader]
+ *                              reading file with the mpc grammar, through
+ *                              its AST or by hand
+ */
+#define main lishp_main
+#include "../../repl.c"
+#undef main
+
+#include <ctype.h>
+#include <time.h>
+
+#define LOOKUPS 1000000
+#define ADDS 1000
+#define LIST_OPS 20
+
+double seconds_since(clock_t start) { return (double)(clock() - start) / CLOCKS_PER_SEC; }
+
+double bench_lookup(int n) {
+  lenv* env = lenv_new();
+  lval** syms = malloc(sizeof(lval*) * n);
+  char name[32];
+
+  for (int i = 0; i < n; i++) {
+    snprintf(name, sizeof(name), "b%d", i);
+    syms[i] = lval_sym(name);
+    lval* val = lval_num(i);
+    lenv_insert(syms[i], env, val);
+    lval_del(val);
+  }
+
+  clock_t start = clock();
+  for (int i = 0; i < LOOKUPS; i++) {
+    lval_del(lenv_get(syms[i % n], env));
+  }
+  double t = seconds_since(start);
+
+  for (int i = 0; i < n; i++) { lval_del(syms[i]); }
+  free(syms);
+  lenv_del(env);
+  return t;
+}
+
+double bench_add(int n) {
+  lenv* env = lenv_new();
+  lenv_add_builtins(env);
+  lval** exprs = malloc(sizeof(lval*) * ADDS);
+
+  for (int i = 0; i < ADDS; i++) {
+    exprs[i] = lval_add(lval_sexpr(), lval_sym("+"));
+    for (int j = 1; j <= n; j++) { exprs[i] = lval_add(exprs[i], lval_num(j)); }
+  }
+
+  clock_t start = clock();
+  for (int i = 0; i < ADDS; i++) {
+    lval_del(lval_run(exprs[i], env));
+  }
+  double t = seconds_since(start);
+
+  free(exprs);
+  lenv_del(env);
+  return t;
+}
+
+lval* bench_list(int n) { /* {1 2 ... n} */
+  lval* list = lval_qexpr();
+  for (int i = 1; i <= n; i++) { list = lval_add(list, lval_num(i)); }
+  return list;
+}
+
+double bench_list_op(char* op, int n) { /* (op xs xs) for join, (op xs) otherwise */
+  lenv* env = lenv_new();
+  lenv_add_builtins(env);
+  double t = 0;
+
+  for (int i = 0; i < LIST_OPS; i++) {
+    lval* expr = lval_add(lval_add(lval_sexpr(), lval_sym(op)), bench_list(n));
+    if (strcmp(op, "join") == 0) { expr = lval_add(expr, bench_list(n)); }
+
+    clock_t start = clock();
+    lval* res = lval_run(expr, env);
+    t += seconds_since(start);
+    lval_del(res);
+  }
+
+  lenv_del(env);
+  return t;
+}
+
+double bench_print(int n) {
+  lval* list = lval_qexpr();
+  for (int i = 1; i <= n; i++) { list = lval_add(list, lval_num(i % 2 ? i * 7919L : -i)); }
+  lbuf out = { NULL, 0, 0, fopen("/dev/null", "w") };
+
+  clock_t start = clock();
+  lval_write(&out, list);
+  lbuf_putc(&out, '\n');
+  lbuf_flush(&out);
+  double t = seconds_since(start);
+
+  fclose(out.file);
+  free(out.data);
+  lval_del(list);
+  return t;
+}
+
+double bench_reader(char* path) {
+  FILE* file = fopen(path, "r");
+  if (!file) { return -1; }
+  fseek(file, 0, SEEK_END);
+  long len = ftell(file);
+  char* input = malloc(len + 1);
+  fseek(file, 0, SEEK_SET);
+  input[fread(input, 1, len, file)] = '\0';
+  fclose(file);
+  lval_reader_init(NULL);
+
+  mpc_result_t result;
+  clock_t start = clock();
+  if (lval_parse(path, input, &result)) {
+    lval_del(result.output);
+  } else {
+    mpc_err_delete(result.error);
+  }
+  double t = seconds_since(start);
+
+  lval_reader_cleanup();
+  free(input);
+  return t;
+}
+
+lval* bench_read(char** s) { /* Just enough of a reader for the programs below */
+  while (**s == ' ') { (*s)++; }
+
+  if (**s == '(' || **s == '{') {
+    char close = **s == '(' ? ')' : '}';
+    lval* expr = **s == '(' ? lval_sexpr() : lval_qexpr();
+    for ((*s)++; **s != close; ) {
+      expr = lval_add(expr, bench_read(s));
+      while (**s == ' ') { (*s)++; }
+    }
+    (*s)++;
+    return expr;
+  }
+
+  char name[32];
+  int len = strcspn(*s, " (){}");
+  snprintf(name, sizeof(name), "%.*s", len, *s);
+  *s += len;
+  return isdigit(name[name[0] == '-']) ? lval_num(strtol(name, NULL, 10)) : lval_sym(name);
+}
+
+lval* bench_run(char* src, lenv* env) {
+  return lval_run(bench_read(&src), env);
+}
+
+double bench_fib(int n) {
+  lenv* env = lenv_new();
+  lenv_add_builtins(env);
+  lval_del(bench_run("(def {fib} (\\ {n} {if (< n 2) {n} {+ (fib (- n 1)) (fib (- n 2))}}))", env));
+
+  char src[32];
+  snprintf(src, sizeof(src), "(fib %d)", n);
+  clock_t start = clock();
+  lval_del(bench_run(src, env));
+  double t = seconds_since(start);
+
+  lenv_del(env);
+  return t;
+}
+
+int main(int argc, char** argv) {
+  for (int i = 3; i < argc; i++) {
+    if (strcmp(argv[i], "--tree") == 0) engine = ENGINE_TREE;
+    if (strcmp(argv[i], "--vm") == 0) engine = ENGINE_VM;
+    if (strcmp(argv[i], "--ast-reader") == 0) read_mode = READ_AST;
+    if (strcmp(argv[i], "--hand-reader") == 0) read_mode = READ_HAND;
+  }
+
+  if (argc >= 3 && strcmp(argv[1], "lookup") == 0) {
+    printf("%.3f\n", bench_lookup(atoi(argv[2])));
+    return 0;
+  }
+  if (argc >= 3 && strcmp(argv[1], "add") == 0) {
+    printf("%.3f\n", bench_add(atoi(argv[2])));
+    return 0;
+  }
+  if (argc >= 3 && (strcmp(argv[1], "join") == 0 || strcmp(argv[1], "head") == 0)) {
+    printf("%.3f\n", bench_list_op(argv[1], atoi(argv[2])));
+    return 0;
+  }
+
+  if (argc >= 3 && strcmp(argv[1], "fib") == 0) {
+    printf("%.3f\n", bench_fib(atoi(argv[2])));
+    return 0;
+  }
+
+  if (argc >= 3 && strcmp(argv[1], "print") == 0) {
+    printf("%.3f\n", bench_print(atoi(argv[2])));
+    return 0;
+  }
+
+  if (argc >= 3 && strcmp(argv[1], "read") == 0) {
+    printf("%.3f\n", bench_reader(argv[2]));
+    return 0;
+  }
+
+  fprintf(stderr, "usage: %s lookup|add|join|head|fib|print n [--vm|--tree]\n", argv[0]);
+  fprintf(stderr, "       %s read file [--ast-reader|--hand-reader]\n", argv[0]);
+  return 1;
+}
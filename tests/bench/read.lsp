@@ -0,0 +1,3 @@
+(def {record} {id 816077201 name item_42 tags {alpha beta gamma} pos {-12 40 7} nested {{a 1} {b {2 3}} {c {{4}}}}})
+(def {expr} {+ 1 (* 2 3) (- 10 (/ 8 2)) {list of symbols and 12345 numbers}})
+(def {row} {-1 -22 -333 4444 55555 666666 7777777 88888888 999999999})
@@ -0,0 +1,91 @@
+#!/bin/bash
+# Benchmarks for lishp, built from the tree with $CC (cc by default),
+# $CFLAGS (-O2) and $LIBS (-ledit -lm). bench.c times lishp's internals
+# directly, startup times lishp itself. Each benchmark prints a row per size and set of flags, in
+# seconds, the best of $RUNS runs (3 by default).
+#
+#   tests/bench/run.sh [benchmark...]
+
+root=$(cd "$(dirname "$0")/../.." && pwd)
+dir=$root/tests/bench
+runs=${RUNS:-3}
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+
+${CC:-cc} ${CFLAGS:--O2} -I"$root" "$dir/bench.c" "$root/mpc.c" ${LIBS:--ledit -lm} -o "$scratch/bench" || exit 1
+${CC:-cc} ${CFLAGS:--O2} "$root/repl.c" "$root/mpc.c" ${LIBS:--ledit -lm} -o "$scratch/lishp" || exit 1
+
+best() { # best command..., runs the command $runs times and prints the least number it printed
+  local b="" t i
+  for ((i = 0; i < runs; i++)); do
+    t=$("$@")
+    b=$(awk -v t="$t" -v b="$b" 'BEGIN { print (b == "" || t < b) ? t : b }')
+  done
+  echo "$b"
+}
+
+row() { # row benchmark size flags seconds
+  printf "%-8s %8s  %-24s %8s\n" "$@"
+}
+
+# 10^6 lookups in environments of 10 to 100k bindings
+bench_lookup() {
+  for n in 10 1000 100000; do row lookup $n "" "$(best "$scratch/bench" lookup $n)"; done
+}
+
+# (+ 1 2 ... n) for n from 10 to 1000, with each engine
+bench_add() {
+  for n in 10 100 1000; do
+    for engine in --vm --tree; do row add $n $engine "$(best "$scratch/bench" add $n $engine)"; done
+  done
+}
+
+# Joining two lists and taking the head of one, for lists of 10^3 to 10^6
+# numbers
+bench_list() {
+  for n in 1000 10000 100000 1000000; do
+    for op in join head; do row $op $n "" "$(best "$scratch/bench" $op $n)"; done
+  done
+}
+
+# Recursive fibonacci, with parameters in VM slots and bound by name on --tree
+bench_fib() {
+  for n in 20 25; do
+    for engine in --vm --tree; do row fib $n $engine "$(best "$scratch/bench" fib $n $engine)"; done
+  done
+}
+
+# Printing lists of 10^5 and 10^6 numbers
+bench_print() {
+  for n in 100000 1000000; do row print $n "" "$(best "$scratch/bench" print $n)"; done
+}
+
+# Reading about 1 and 8 MB of the forms in read.lsp, repeated, with each
+# reader. MB/s is the size over the time.
+bench_read() {
+  for mb in 1 8; do
+    local copies=$((mb * 1000000 / $(wc -c < "$dir/read.lsp")))
+    for ((i = 0; i < copies; i++)); do cat "$dir/read.lsp"; done > "$scratch/corpus.lsp"
+    for reader in "" --ast-reader --hand-reader; do
+      row read ${mb}MB "$reader" "$(best "$scratch/bench" read "$scratch/corpus.lsp" $reader)"
+    done
+  done
+}
+
+# Starting lishp 200 times on a one line script, building the grammar or
+# loading it from a snapshot
+launch() { # launch flags..., prints the wall seconds of 200 runs
+  local i
+  TIMEFORMAT=%R
+  { time for ((i = 0; i < 200; i++)); do "$scratch/lishp" "$@" "$dir/startup.lsp" > /dev/null; done; } 2>&1
+}
+
+bench_startup() {
+  "$scratch/lishp" --save-grammar="$scratch/grammar.snap" || return
+  row startup 200 "" "$(best launch)"
+  row startup 200 --grammar=grammar.snap "$(best launch --grammar="$scratch/grammar.snap")"
+}
+
+benchmarks=${*:-lookup add list fib print read startup}
+row bench size flags seconds
+for b in $benchmarks; do "bench_$b"; done
@@ -0,0 +1,23 @@
+(def {collections} (\ {} {nth (gc-stats) 1}))
+(def {before} (collections))
+(def {build} (\ {n acc} {if (== n 0) {acc} {build (- n 1) (join acc (list n))}}))
+(def {churn} (\ {n acc} {if (== n 0) {len acc} {churn (- n 1) (tail (join acc {1 2 3}))}}))
+(def {big} (build 5000 {}))
+(def {view} (tail (init big)))
+(def {nested} {{a {b c}} {d} e})
+(def {add} (\ {x y} {+ x y}))
+(churn 300000 {})
+(> (- (collections) before) 2)
+(len big)
+(nth big 4999)
+(len view)
+(head view)
+nested
+(add 1 2)
+(def {kept} (\ {n} {if (== n 0) {{}} {join {{x}} (kept (- n 1))}}))
+(len (kept 2000))
+(def {grow} (\ {n xs} {if (== n 0) {xs} {grow (- n 1) (join (tail (join {0} xs)) (list n (list n)))}}))
+(def {g} (grow 20000 {}))
+(len g)
+(nth g 39999)
+(nth g 1)
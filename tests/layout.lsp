@@ -0,0 +1,37 @@
+{}
+{1}
+{1 2}
+{1 2 3}
+{1 2 3 4}
+{1 {2 {3 {4 {5}}}}}
+(cons 1 {2 3})
+(cons 0 {1 2 3})
+(join {1} {2 3})
+(join {1 2} {3 4} {5})
+(init {1 2 3 4})
+(tail {1 2 3 4})
+(len {a b c d e})
+(nth {a b c d e} 4)
+(def {xs} {1 2 3})
+(def {ys} (cons 0 xs))
+xs
+ys
+(def {zs} (join xs xs))
+xs
+zs
+(eval (join (list +) {1 2 3}))
+(eval {+ 1 (* 2 3) (- 10 4) 5})
+4611686018427387903
+4611686018427387904
+-4611686018427387904
+-4611686018427387905
+(+ 4611686018427387903 1)
+(- (+ 4611686018427387903 1) 1)
+(* 3037000499 3037000499)
+9223372036854775807
+(== 4611686018427387904 (+ 4611686018427387903 1))
+(list 4611686018427387904 {a} {b})
+(head {4611686018427387904 1})
+(/ 1 0)
+{+ - \ def}
+(list + (\ {x} {x}))
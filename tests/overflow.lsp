@@ -0,0 +1,14 @@
+(/ -9223372036854775808 -1)
+(% -9223372036854775808 -1)
+(/ -9223372036854775808 1 -1)
+(/ -9223372036854775807 -1)
+(% -9223372036854775808 2)
+(def {f} (\ {} {/ -9223372036854775808 -1}))
+(f)
+(def {g} (\ {x} {% x -1}))
+(g -9223372036854775808)
+(g 7)
+(def {h} (\ {} {- (* 3037000499 3037000499) 9223372036854775807}))
+(h)
+(def {k} (\ {} {- -9223372036854775807 1}))
+(k)
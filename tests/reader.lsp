@@ -0,0 +1,31 @@
+5-
+1-2
+(list 5- 1-2 a5 5a)
+(list -0 007 -12 +)
+{a_b+c-d*e/f\g=h<i>j!k&l%m}
+{-a - -- -1 1- }
+	( +	1
+  2 )
+(+ 1
+   (* 2
+      3))
+{}{}()
+(head {x y})(tail {x y})
+{{{{{{{{{{deep}}}}}}}}}}
+{((}))
+(+ 1 2))
+(+ 1 #)
+{1 2
+3} (
+4 5)) 6
+(+ 1 2)
+{-9223372036854775808 9223372036854775807}
+9223372036854775808
+-9223372036854775809
+{99999999999999999999999 1}
+{12abc -3x x-3 -}
+{aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa b}
+{bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc}
+{((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((x))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))}
+{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{x}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+(list 1 2
@@ -0,0 +1,18 @@
+(def {h} (\ {} {* 2 3}))
+(def {s} (\ {x} {if (> 2 1) {+ x 1} {0}}))
+(def {t} (\ {x} {and (< 1 2) x}))
+(h)
+(s 1)
+(t 1)
+(def {*} +)
+(h)
+(s 1)
+(t 1)
+(def {>} <)
+(s 1)
+(def {and} or)
+(t 0)
+(def {if} (\ {c a b} {b}))
+(s 1)
+(def {+} (\ {a b} {list a b}))
+(h)
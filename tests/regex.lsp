@@ -0,0 +1,26 @@
+0
+-0
+-
+--
+-1-
+123456789012345678
+{1234567890123456789012345678901234567890123456789012345678901234567890}
+{abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 +_-*/\=<>!&%}
+{0a a0 -a0 a-0 0-a -0a}
+{1.5}
+12#
+ab#
+-#
+(- #)
+(+ 1 2 #)
+{1 -}
+{1 - }
+{- 1}
+1 2 3
+(list 1 2 3)a
+#
+ #
+	#
+{a}#
+(+ 1 12
+(-
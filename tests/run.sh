@@ -0,0 +1,45 @@
+#!/bin/sh
+# Run every tests/*.lsp with each engine and compare against tests/*.out.
+# Each line of tests/*.flags, when there is one, is a set of flags to run
+# with, an empty line runs without any. Scripts are read from stdin so
+# errors name <stdin> wherever the tests are run from. They run in a
+# scratch directory holding grammar.snap, a grammar snapshot saved by
+# the lishp under test, and corrupt.snap, a copy with one byte changed.
+#
+#   cc -std=c11 -O2 repl.c mpc.c -ledit -lm -o lishp
+#   tests/run.sh ./lishp
+
+lishp=${1:-./lishp}
+dir=$(dirname "$0")
+status=0
+
+case $lishp in */*) lishp=$(cd "$(dirname "$lishp")" && pwd)/$(basename "$lishp") ;; esac
+scratch=$(mktemp -d)
+trap 'rm -rf "$scratch"' EXIT
+
+if ! "$lishp" --save-grammar="$scratch/grammar.snap"; then
+  echo "FAIL --save-grammar"
+  status=1
+fi
+{ head -c 300 "$scratch/grammar.snap"; printf '\377'; tail -c +302 "$scratch/grammar.snap"; } > "$scratch/corrupt.snap"
+
+check() { # check script flags
+  for engine in --vm --tree; do
+    if (cd "$scratch" && "$lishp" $engine $2 -) < "$1" 2>&1 | cmp -s - "${1%.lsp}.out"; then
+      echo "ok   $engine${2:+ $2} $1"
+    else
+      echo "FAIL $engine${2:+ $2} $1"
+      status=1
+    fi
+  done
+}
+
+for script in "$dir"/*.lsp; do
+  if [ -f "${script%.lsp}.flags" ]; then
+    while IFS= read -r flags; do check "$script" "$flags"; done < "${script%.lsp}.flags"
+  else
+    check "$script" ""
+  fi
+done
+
+exit $status
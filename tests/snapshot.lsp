@@ -0,0 +1,7 @@
+(+ 1 (* 2 3) -4)
+{a {b} (c d)}
+(def {f} (\ {x} {head x}))
+(f {1 2 3})
+(+ 1 #)
+(len {1 2
+3})
@@ -0,0 +1,31 @@
+(def {x} (nth {(+ 1 2)} 0))
+x
+(def {k} (\ {y} {def {z} (+ y 1)}))
+(k 5)
+z
+(def {app} (\ {f a b} {f a b}))
+(app def {w} {(+ 1 2)})
+w
+(if (/ 1 0))
+(if 1 {1})
+(if {1} {2} {3})
+(if 0 {(/ 1 0)} {2})
+(and 1 (or 0 1) 1)
+(def {f} (\ {x} {and x (/ 1 0)}))
+(def {g} (\ {x} {or x (/ 1 0)}))
+(def {+} -)
+(f 0)
+(g 1)
+(def {h} (\ {x} {and x (/ 1 0) 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1}))
+(h 0)
+()
+((\ {x} {}) 1)
+(def {f} (\ {} {}))
+(f)
+(eval {})
+(if 1 {} {2})
+(if 0 {1} {})
+(list () ())
+(def {g} (\ {x} {if x {} {()}}))
+(g 1)
+(g 0)
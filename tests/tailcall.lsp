@@ -0,0 +1,11 @@
+(def {loop} (\ {n} {if (== n 0) {0} {loop (- n 1)}}))
+(loop 1000000)
+(def {even} (\ {n} {if (== n 0) {1} {odd (- n 1)}}))
+(def {odd} (\ {n} {if (== n 0) {0} {even (- n 1)}}))
+(even 1000001)
+(def {nest} (\ {q n} {if (== n 0) {q} {nest (list eval q) (- n 1)}}))
+(eval (nest {1} 200000))
+(def {count} (\ {n acc} {if (== n 0) {acc} {eval {count (- n 1) (+ acc 1)}}}))
+(count 1000000 0)
+(def {sum} (\ {n} {if (== n 0) {0} {+ n (sum (- n 1))}}))
+(sum 1000)
@@ -0,0 +1,52 @@
+(def {range} (\ {a b} {if (> a b) {{}} {join (list a) (range (+ a 1) b)}}))
+(def {sum} (\ {xs acc} {if (== xs {}) {acc} {sum (tail xs) (+ acc (eval (head xs)))}}))
+(def {rev} (\ {xs acc} {if (== xs {}) {acc} {rev (tail xs) (join (head xs) acc)}}))
+(def {build} (\ {n acc} {if (== n 0) {acc} {build (- n 1) (join acc (list n))}}))
+(def {a63} (range 1 63))
+(def {a64} (range 1 64))
+(def {a65} (range 1 65))
+(len a63)
+(len a64)
+(len a65)
+a64
+(tail a64)
+(init a64)
+(tail a65)
+(init a65)
+(tail (tail a65))
+(init (init a65))
+(head a64)
+(nth a64 0)
+(nth a64 63)
+(nth a65 64)
+(nth a64 64)
+(== a64 (join (range 1 32) (range 33 64)))
+(== (tail a65) (range 2 65))
+(== (init a65) a64)
+(== a63 (init a64))
+(join a63 {64})
+(join {0} a64)
+(len (join a64 a64))
+(nth (join a64 a65) 100)
+(eval (join {+} a64))
+(sum a65 0)
+(rev a65 {})
+a65
+(def {big} (build 40000 {}))
+(len big)
+(nth big 0)
+(nth big 1023)
+(nth big 1024)
+(nth big 32767)
+(nth big 32768)
+(nth big 39999)
+(sum big 0)
+(def {half} (join (tail big) (init big)))
+(len half)
+(nth half 0)
+(nth half 39998)
+(nth half 39999)
+(nth half 79997)
+(len big)
+(== (tail (init big)) (init (tail big)))
+(head (rev big {}))
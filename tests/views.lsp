@@ -0,0 +1,40 @@
+(def {range} (\ {a b} {if (> a b) {{}} {join (list a) (range (+ a 1) b)}}))
+(def {build} (\ {n acc} {if (== n 0) {acc} {build (- n 1) (join acc (list n))}}))
+(def {count} (\ {xs n} {if (== xs {}) {n} {count (tail xs) (+ n 1)}}))
+(def {drop} (\ {xs n} {if (== n 0) {xs} {drop (tail xs) (- n 1)}}))
+(def {trim} (\ {xs n} {if (== n 0) {xs} {trim (init xs) (- n 1)}}))
+(def {xs} (range 1 100))
+(def {ys} (tail xs))
+(def {zs} (init xs))
+(def {ws} (tail (init ys)))
+(len xs)
+(len ys)
+(len zs)
+(len ws)
+(head ys)
+(head zs)
+(head ws)
+(nth ws 95)
+(nth ws 96)
+(== ws (range 3 99))
+(== (drop xs 50) (range 51 100))
+(== (trim xs 50) (range 1 50))
+(drop (trim xs 30) 60)
+(trim (drop xs 90) 5)
+(join (drop xs 95) (trim xs 95))
+(len (join ys zs ws))
+(eval (join {+} (drop xs 90)))
+(== xs (range 1 100))
+(def {nested} (join (list {a b} {c}) (range 1 70)))
+(head nested)
+(head (tail nested))
+(len (tail (tail nested)))
+(def {nested} (tail nested))
+(head nested)
+(drop (range 1 3) 1)
+(trim {1 2 3} 2)
+(tail {1})
+(init {1})
+(tail (tail (range 1 64)))
+(count (build 100000 {}) 0)
+(len (trim (build 100000 {}) 99990))